@@ -12,6 +12,19 @@
  * ChangeLog:
  * --------
  * * 2025-07-11 created.
+ * * 2026-10-18 batched conversion and read of all devices
+ * * 2026-10-18 CRC-8 check of ROM codes and scratchpad, retries, error counters
+ * * 2026-10-18 alarm search and per-device alarm thresholds
+ * * 2026-10-18 sorted device table, family and incremental search
+ * * 2026-10-18 insertion and removal in the device table
+ * * 2026-10-18 parasite power detection and strong pull-up
+ * * 2026-10-18 per-device resolution and conversion
+ * * 2026-10-18 integer temperature conversion and formatting
+ * * 2026-10-18 pin functions replaceable by the host simulator, read slot
+ *              sampled within 15 µs, end of conversion confirmed twice,
+ *              no duplicates from DS18B20_scanBus()
+ * * 2026-10-18 bus access moved to onewire.c, the pin and byte functions
+ *              remain as wrappers
  */
 
 #include <ds18b20.h>
@@ -19,10 +32,68 @@
 /**
  * @brief globals
  */
-volatile PORT_t *DS_PORT;
-uint8_t  DS_PIN_bm;
 uint64_t DS_addresses[DS_MAX_DEVICES];
 uint16_t DS_devcount = 0;
+uint16_t DS_dropped = 0;
+uint8_t  DS_resolution = DS18B20_CFG_12BIT;
+uint8_t  DS_parasite = 0;
+DS_stats_t DS_stats;
+
+/**
+ * @brief tables for the Dallas/Maxim CRC-8, polynomial 0x8c (reflected)
+ */
+#if DS_CRC8_TABLE
+static const PROGMEM uint8_t DS_crc8table[256] = {
+    0x00, 0x5E, 0xBC, 0xE2, 0x61, 0x3F, 0xDD, 0x83,
+    0xC2, 0x9C, 0x7E, 0x20, 0xA3, 0xFD, 0x1F, 0x41,
+    0x9D, 0xC3, 0x21, 0x7F, 0xFC, 0xA2, 0x40, 0x1E,
+    0x5F, 0x01, 0xE3, 0xBD, 0x3E, 0x60, 0x82, 0xDC,
+    0x23, 0x7D, 0x9F, 0xC1, 0x42, 0x1C, 0xFE, 0xA0,
+    0xE1, 0xBF, 0x5D, 0x03, 0x80, 0xDE, 0x3C, 0x62,
+    0xBE, 0xE0, 0x02, 0x5C, 0xDF, 0x81, 0x63, 0x3D,
+    0x7C, 0x22, 0xC0, 0x9E, 0x1D, 0x43, 0xA1, 0xFF,
+    0x46, 0x18, 0xFA, 0xA4, 0x27, 0x79, 0x9B, 0xC5,
+    0x84, 0xDA, 0x38, 0x66, 0xE5, 0xBB, 0x59, 0x07,
+    0xDB, 0x85, 0x67, 0x39, 0xBA, 0xE4, 0x06, 0x58,
+    0x19, 0x47, 0xA5, 0xFB, 0x78, 0x26, 0xC4, 0x9A,
+    0x65, 0x3B, 0xD9, 0x87, 0x04, 0x5A, 0xB8, 0xE6,
+    0xA7, 0xF9, 0x1B, 0x45, 0xC6, 0x98, 0x7A, 0x24,
+    0xF8, 0xA6, 0x44, 0x1A, 0x99, 0xC7, 0x25, 0x7B,
+    0x3A, 0x64, 0x86, 0xD8, 0x5B, 0x05, 0xE7, 0xB9,
+    0x8C, 0xD2, 0x30, 0x6E, 0xED, 0xB3, 0x51, 0x0F,
+    0x4E, 0x10, 0xF2, 0xAC, 0x2F, 0x71, 0x93, 0xCD,
+    0x11, 0x4F, 0xAD, 0xF3, 0x70, 0x2E, 0xCC, 0x92,
+    0xD3, 0x8D, 0x6F, 0x31, 0xB2, 0xEC, 0x0E, 0x50,
+    0xAF, 0xF1, 0x13, 0x4D, 0xCE, 0x90, 0x72, 0x2C,
+    0x6D, 0x33, 0xD1, 0x8F, 0x0C, 0x52, 0xB0, 0xEE,
+    0x32, 0x6C, 0x8E, 0xD0, 0x53, 0x0D, 0xEF, 0xB1,
+    0xF0, 0xAE, 0x4C, 0x12, 0x91, 0xCF, 0x2D, 0x73,
+    0xCA, 0x94, 0x76, 0x28, 0xAB, 0xF5, 0x17, 0x49,
+    0x08, 0x56, 0xB4, 0xEA, 0x69, 0x37, 0xD5, 0x8B,
+    0x57, 0x09, 0xEB, 0xB5, 0x36, 0x68, 0x8A, 0xD4,
+    0x95, 0xCB, 0x29, 0x77, 0xF4, 0xAA, 0x48, 0x16,
+    0xE9, 0xB7, 0x55, 0x0B, 0x88, 0xD6, 0x34, 0x6A,
+    0x2B, 0x75, 0x97, 0xC9, 0x4A, 0x14, 0xF6, 0xA8,
+    0x74, 0x2A, 0xC8, 0x96, 0x15, 0x4B, 0xA9, 0xF7,
+    0xB6, 0xE8, 0x0A, 0x54, 0xD7, 0x89, 0x6B, 0x35};
+#else
+static const PROGMEM uint8_t DS_crc8nibble[16] = {
+    0x00, 0x9D, 0x23, 0xBE, 0x46, 0xDB, 0x65, 0xF8, 0x8C, 0x11, 0xAF, 0x32, 0xCA, 0x57, 0xE9, 0x74};
+#endif
+
+/**
+ * @name DS18B20_backoff()
+ * @param retry number of the retry 0..
+ * @brief waits 2^retry ms before a retry
+ * @note internal use
+ */
+void DS18B20_backoff(uint8_t retry)
+{
+  for (uint16_t t = 1 << retry; t > 0; t--)
+  {
+    _delay_ms(1);
+  }
+}
 
 /**
  * @name DS18B20_init()
@@ -33,101 +104,106 @@ uint16_t DS_devcount = 0;
  */
 void DS18B20_init(volatile PORT_t *ds_port, uint8_t pin)
 {
-    DS_PORT   = ds_port;
-    DS_PIN_bm = 1 << pin;
-    DS_PORT->PINCONFIG = PORT_PULLUPEN_bm | PORT_ISC_INTDISABLE_gc;
-    DS_PORT->PINCTRLUPD = DS_PIN_bm;
+  OW_init(ds_port, pin);
 }
 
+/*
+ * the following functions are kept for existing applications, the bus
+ * access itself is in onewire.c
+ */
+
 /**
  * @name DS18B20_set()
- * @brief set the pin to 0 and declare as output
- * @note internal use
+ * @brief see OW_set()
  */
 void DS18B20_set(void)
 {
-    DS_PORT->DIRSET = DS_PIN_bm;
-    DS_PORT->OUTCLR = DS_PIN_bm;
+  OW_set();
 }
 
 /**
  * @name DS18B20_release()
- * @brief release the port pin, keep pull-up active
- * @note internal use
+ * @brief see OW_release()
  */
 void DS18B20_release(void)
 {
-    DS_PORT->DIRCLR = DS_PIN_bm;
+  OW_release();
 }
 
 /**
  * @name DS18B20_get()
- * @param none
- * @return uint8_t state of the pin 1/0
- * @brief reads the state of the 1-wire line, receiving the answer from the device
- * @note internal use
+ * @brief see OW_get()
  */
 uint8_t DS18B20_get(void)
 {
-    return (DS_PORT->IN & DS_PIN_bm) ? 1 : 0;
+  return OW_get();
+}
+
+/**
+ * @name DS18B20_strongPullup()
+ * @brief see OW_strongPullup()
+ */
+void DS18B20_strongPullup(uint8_t on)
+{
+  OW_strongPullup(on);
 }
 
 /**
  * @name DS18B20_reset()
- * @return uint8_t returns the state of the 1-wire line after a bus-reset
- * @brief resets the 1-wire bus devices by pulling the line low for 480 µs
- * @note internal use
+ * @return uint8_t state of the 1-wire line after the bus-reset, 0 if at
+ *         least one device is present
+ * @brief sets OW_speed to OW_SPEED_STANDARD and resets the bus, the
+ *        DS18B20 has no overdrive
  */
 uint8_t DS18B20_reset(void)
 {
-  uint8_t result;
-
-  DS18B20_set();
-  _delay_us(480);
-  DS18B20_release();
-  _delay_us(60);
-  result = DS18B20_get();
-  _delay_us(420);
-  return result;
+  OW_speed = OW_SPEED_STANDARD;
+  return OW_reset();
 }
 
 /**
  * @name DS18B20_writeBit()
- * @param bit - the bit to write 1/0
- * @return none
- * @brief writes a bit on the 1-wire bus
- * @note internal use
+ * @brief see OW_writeBit()
  */
 void DS18B20_writeBit(uint8_t bit)
 {
-  DS18B20_set();
-  _delay_us(1);
-  if (bit > 0)
-  {
-    DS18B20_release();
-  }
-  _delay_us(59);
-  DS18B20_release();
-  _delay_us(1);
+  OW_writeBit(bit);
 }
 
 /**
  * @name DS18B20_write()
- * @param byte - data to be written to the 1-wire devices
- * @return none
- * @brief writes one byte of data on the 1-wire bus
+ * @brief see OW_write()
  */
 void DS18B20_write(uint8_t byte)
-{  // LSB first
-  uint8_t i;
-  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
-  {
-    for (i=8; i>0; i--)
-    {
-      DS18B20_writeBit(byte & 0b00000001);
-      byte >>= 1;
-    }
-  }
+{
+  OW_write(byte);
+}
+
+/**
+ * @name DS18B20_readBit()
+ * @brief see OW_readBit()
+ */
+uint8_t DS18B20_readBit(void)
+{
+  return OW_readBit();
+}
+
+/**
+ * @name DS18B20_read()
+ * @brief see OW_read()
+ */
+uint8_t DS18B20_read(void)
+{
+  return OW_read();
+}
+
+/**
+ * @name DS18B20_select()
+ * @brief see OW_select()
+ */
+void DS18B20_select(uint64_t address)
+{
+  OW_select(address);
 }
 
 /**
@@ -140,51 +216,323 @@ void DS18B20_write(uint8_t byte)
  */
 void DS18B20_write_config(int8_t THIGH, int8_t TLOW, uint8_t CONFIG)
 {
-    DS18B20_write(DS18B20_CMD_WSCRATCHPAD);
-    DS18B20_write(THIGH);
-    DS18B20_write(TLOW);
-    DS18B20_write(CONFIG);
+    OW_write(DS18B20_CMD_WSCRATCHPAD);
+    OW_write(THIGH);
+    OW_write(TLOW);
+    OW_write(CONFIG);
+    DS_resolution = CONFIG & DS18B20_CFG_gm;
 }
 
+
 /**
- * @name DS18B20_readBit()
- * @return uint8_t - value of the bit 1/0
- * @brief triggers the reading of a single bit from the device
+ * @name DS18B20_searchPass()
+ * @param search state of the search
+ * @param address receives the ROM code of this pass
+ * @param next receives the path for the next pass
+ * @return uint8_t - number of bits received, 64 for a complete ROM code, 0
+ *         if no device (of the requested family) answered
+ * @brief one pass of the ROM search, see DS18B20_scanBus()
  * @note internal use
  */
-uint8_t DS18B20_readBit (void)
+static uint8_t DS18B20_searchPass(DS_search_t *search, uint64_t *address, uint64_t *next)
 {
-  uint8_t result;
+  uint64_t addr,pos;                        /* decision markers */
+  uint8_t count = 0;                        /* bit count */
+  uint8_t bit,chk;                          /* bit values */
+  uint8_t want;
 
-  DS18B20_set();
-  _delay_us(1);
-  DS18B20_release();
-  _delay_us(15);
-  result = DS18B20_get();
-  DS18B20_release();
-  _delay_us(45);
-  return result;
+  addr = 0;
+  *next=0;                                  /* next path to follow */
+  pos=1;                                    /* path bit pointer */
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    DS18B20_reset();
+    OW_write(search->command);
+    for (count=0; count<64; count++)
+    {                                       /* each bit of the ROM value */
+      bit = OW_readBit();
+      chk = OW_readBit();
+      if (bit && chk)
+      {                                     /* no device answers */
+        break;
+      }
+      if (search->family && (count < 8))
+      {                                     /* the family code is fixed */
+        want = (search->family >> count) & 0b00000001;
+        if (!bit && !chk)
+        {
+          bit = want;                       /* no branch to remember */
+        }
+        else if (bit != want)
+        {                                   /* no device of this family */
+          count = 0;
+          break;
+        }
+      }
+      else if (!bit && !chk)
+      {                                     /* collision, both are zero */
+        if (pos & search->path)
+        {
+          bit=1;                            /* if we've been here before */
+        }
+        else
+        {
+          *next=(search->path&(pos-1))|pos; /* else, new branch for next */
+        }
+        pos<<=1;
+      }
+      OW_writeBit(bit);
+      addr |= (uint64_t)bit << count;
+    }
+  } // atomic block
+  *address = addr;
+  return count;
 }
 
 /**
- * @name DS18B20_read()
- * @return uint8_t - value returned by the device, 1 byte
- * @brief triggers the reading of a single byte from the device
+ * @name DS18B20_searchStart()
+ * @param search state of the search
+ * @param command DS18B20_CMD_SEARCHROM or DS18B20_CMD_ALARMSEARCH
+ * @param family family code of the wanted devices, 0 for all devices
+ * @return none
+ * @brief prepares an incremental search, see DS18B20_searchNext()
  */
-uint8_t DS18B20_read(void)
-{  // LSB first
-  uint8_t i, result=0;
-  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+void DS18B20_searchStart(DS_search_t *search, uint8_t command, uint8_t family)
+{
+  search->path = 0;
+  search->command = command;
+  search->family = family;
+  search->state = DS_SEARCH_FIRST;
+}
+
+/**
+ * @name DS18B20_searchNext()
+ * @param search state of the search
+ * @param address receives the next ROM code
+ * @return uint8_t - 1 if a device was found, 0 if the search is finished
+ * @brief runs search passes until the next device with a valid ROM code is
+ *        found, passes with CRC errors are repeated up to DS_RETRIES times
+ */
+uint8_t DS18B20_searchNext(DS_search_t *search, uint64_t *address)
+{
+  uint64_t next;
+  uint8_t  count, retry, valid;
+
+  while (search->state != DS_SEARCH_DONE)
   {
-    for (i=8; i>0; i--)
+    retry = 0;
+    do
+    {                                       /* repeat passes with CRC errors */
+      count = DS18B20_searchPass(search, address, &next);
+      if ((count == 0) && (search->state == DS_SEARCH_FIRST))
+      {                                     /* no device at all */
+        search->state = DS_SEARCH_DONE;
+        return 0;
+      }
+      valid = (count == 64) && DS18B20_checkROM(*address);
+      if (!valid)
+      {
+        DS_stats.crcErrors++;
+        if (retry < DS_RETRIES)
+        {
+          DS_stats.retries++;
+          DS18B20_backoff(retry);
+        }
+      }
+    } while (!valid && (retry++ < DS_RETRIES));
+
+    search->path = next;
+    search->state = next ? DS_SEARCH_RUNNING : DS_SEARCH_DONE;
+    if (valid)
     {
-      result >>= 1;
-      result |= (DS18B20_readBit() & 0b00000001) << 7;
+      return 1;
     }
+    DS_stats.failures++;
   }
-  return result;
+  return 0;
 }
 
+/**
+ * @name DS18B20_searchList()
+ * @param search prepared state of the search
+ * @param list array for the found addresses
+ * @param max size of list
+ * @return uint16_t - number of addresses stored in list
+ * @brief runs a complete search, devices which do not fit into list are
+ *        counted in DS_dropped
+ * @note internal use
+ */
+static uint16_t DS18B20_searchList(DS_search_t *search, uint64_t *list, uint16_t max)
+{
+  uint64_t addr;
+  uint16_t numdev = 0;
+
+  DS_dropped = 0;
+  while (DS18B20_searchNext(search, &addr))
+  {
+    if (numdev < max)
+    {
+      list[numdev++] = addr;
+    }
+    else
+    {
+      DS_dropped++;
+    }
+    _delay_ms(1);
+  }
+  return numdev;
+}
+
+/**
+ * @name DS18B20_search()
+ * @param command DS18B20_CMD_SEARCHROM or DS18B20_CMD_ALARMSEARCH
+ * @param list array for the found addresses
+ * @param max size of list
+ * @return uint16_t - number of addresses stored in list
+ * @brief the ROM search of DS18B20_scanBus() with a selectable search command
+ */
+uint16_t DS18B20_search(uint8_t command, uint64_t *list, uint16_t max)
+{
+  DS_search_t search;
+
+  DS18B20_searchStart(&search, command, 0);
+  return DS18B20_searchList(&search, list, max);
+}
+
+/**
+ * @name DS18B20_searchFamily()
+ * @param family family code of the wanted devices, e.g. DS18B20_FAMILY
+ * @param list array for the found addresses
+ * @param max size of list
+ * @return uint16_t - number of addresses stored in list
+ * @brief ROM search which only follows the branches of one family code
+ */
+uint16_t DS18B20_searchFamily(uint8_t family, uint64_t *list, uint16_t max)
+{
+  DS_search_t search;
+
+  DS18B20_searchStart(&search, DS18B20_CMD_SEARCHROM, family);
+  return DS18B20_searchList(&search, list, max);
+}
+
+/**
+ * @name DS18B20_sort()
+ * @param list array of addresses
+ * @param count number of addresses in list
+ * @return none
+ * @brief sorts a list of addresses in ascending order (insertion sort, the
+ *        search delivers the addresses already partly ordered)
+ */
+void DS18B20_sort(uint64_t *list, uint16_t count)
+{
+  uint64_t addr;
+  uint16_t i, j;
+
+  for (i=1; i<count; i++)
+  {
+    addr = list[i];
+    for (j=i; (j>0) && (list[j-1] > addr); j--)
+    {
+      list[j] = list[j-1];
+    }
+    list[j] = addr;
+  }
+}
+
+/**
+ * @name DS18B20_find()
+ * @param address 64-bit ID address of a device
+ * @return int16_t - index of the device in DS_addresses[], -1 if unknown
+ * @brief binary search in the sorted device table
+ */
+int16_t DS18B20_find(uint64_t address)
+{
+  uint16_t lo = 0, hi = DS_devcount, mid;
+
+  while (lo < hi)
+  {
+    mid = lo + (hi - lo) / 2;
+    if (DS_addresses[mid] < address)
+    {
+      lo = mid + 1;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+  return ((lo < DS_devcount) && (DS_addresses[lo] == address)) ? (int16_t)lo : -1;
+}
+
+/**
+ * @name DS18B20_insert()
+ * @param address 64-bit ID address of a device
+ * @return int16_t - index of the device in DS_addresses[], -1 if the table
+ *         is full
+ * @brief adds a device to the sorted device table, known devices are not
+ *        added twice
+ */
+int16_t DS18B20_insert(uint64_t address)
+{
+  uint16_t i;
+  int16_t  index = DS18B20_find(address);
+
+  if (index >= 0)
+  {
+    return index;
+  }
+  if (DS_devcount >= DS_MAX_DEVICES)
+  {
+    DS_dropped++;
+    return -1;
+  }
+  for (i=DS_devcount; (i>0) && (DS_addresses[i-1] > address); i--)
+  {
+    DS_addresses[i] = DS_addresses[i-1];
+  }
+  DS_addresses[i] = address;
+  DS_devcount++;
+  return i;
+}
+
+/**
+ * @name DS18B20_remove()
+ * @param index index of the device in DS_addresses[]
+ * @return none
+ * @brief removes a device from the sorted device table
+ */
+void DS18B20_remove(uint16_t index)
+{
+  if (index >= DS_devcount)
+  {
+    return;
+  }
+  DS_devcount--;
+  for (uint16_t i=index; i<DS_devcount; i++)
+  {
+    DS_addresses[i] = DS_addresses[i+1];
+  }
+}
+
+/**
+ * @name DS18B20_countPrefix()
+ * @param prefix the lower bits of a ROM code
+ * @param bits number of valid bits in prefix 1..64
+ * @return uint16_t - number of devices in DS_addresses[] starting with prefix
+ */
+uint16_t DS18B20_countPrefix(uint64_t prefix, uint8_t bits)
+{
+  uint64_t mask = (bits < 64) ? (((uint64_t)1 << bits) - 1) : ~(uint64_t)0;
+  uint16_t n = 0;
+  for (uint16_t i=0; i<DS_devcount; i++)
+  {
+    if ((DS_addresses[i] & mask) == prefix)
+    {
+      n++;
+    }
+  }
+  return n;
+}
 
 /**
  * @name DS18B20_scanBus()
@@ -193,6 +541,12 @@ uint8_t DS18B20_read(void)
  * @brief scans the bus for the IDs of the attached devices
  * 1-wire ROM Search routine
  *
+ * DS_addresses[] is sorted afterwards, see DS18B20_find(). Devices
+ * beyond DS_MAX_DEVICES are counted in DS_dropped.
+ *
+ * Passes which return a ROM code with a bad CRC are repeated up to
+ * DS_RETRIES times, ROM codes which never pass the check are dropped.
+ *
  * This is an alternative to the published routine. It is
  * not faster than the publshed routine (the number of
  * passes is the same), but it may be easier to implement in
@@ -204,10 +558,10 @@ uint8_t DS18B20_read(void)
  * If there are N devices, this number of bits is at least
  * log_2(N) and not more than N-1 (and not more than 56).
  *
- * This routine does not admit the possibility that the two
- * bits read from the bus are both 1. This would only happen
- * in the event of an error after device presence has been
- * obtained.
+ * The two bits read from the bus are both 1 only if no device
+ * takes part in the search, e.g. in an alarm search without
+ * alarms. A pass which ends this way is treated like a pass
+ * with a CRC error, unless it is the very first pass.
  *
  * The variable 'path' contains sufficient information to
  * conduct one pass. The results of previous passes are not
@@ -220,67 +574,508 @@ uint8_t DS18B20_read(void)
  */
 uint16_t DS18B20_scanBus(void)
 {
-  uint64_t addr,path,next,pos;              /* decision markers */
-  int16_t count, numdev=0;                             /* bit count */
-  uint8_t bit,chk;                          /* bit values */
+  uint16_t i, n;
+
+  n = DS18B20_search(DS18B20_CMD_SEARCHROM, DS_addresses, DS_MAX_DEVICES);
+  DS18B20_sort(DS_addresses, n);
+  // a disturbed pass may deliver a device twice
+  DS_devcount = (n > 0) ? 1 : 0;
+  for (i=1; i<n; i++)
+  {
+    if (DS_addresses[i] != DS_addresses[DS_devcount-1])
+    {
+      DS_addresses[DS_devcount++] = DS_addresses[i];
+    }
+  }
+  return DS_devcount;
+}
 
-  path=0;                                   /* initial path to follow */
+/**
+ * @name DS18B20_readPowerSupply()
+ * @return uint8_t - 1 if at least one device is parasite powered
+ * @brief asks all devices for their power supply (READ POWER SUPPLY, 0xB4),
+ *        sets DS_parasite
+ */
+uint8_t DS18B20_readPowerSupply(void)
+{
+  if (DS18B20_reset() != 0)
+  {
+    return DS_parasite;
+  }
+  OW_write(DS18B20_CMD_SKIPROM);
+  OW_write(DS18B20_CMD_RPWRSUPPLY);
+  // parasite powered devices pull the line low
+  DS_parasite = !OW_readBit();
+  return DS_parasite;
+}
+
+/**
+ * @name DS18B20_conversionTime()
+ * @param config configuration byte, only the resolution bits are used
+ * @return uint16_t - maximum conversion time in ms
+ * @brief conversion time from the datasheet for the given resolution
+ */
+uint16_t DS18B20_conversionTime(uint8_t config)
+{
+  switch (config & DS18B20_CFG_gm)
+  {
+    case DS18B20_CFG_9BIT:
+      return 94;
+    case DS18B20_CFG_10BIT:
+      return 188;
+    case DS18B20_CFG_11BIT:
+      return 375;
+    default:
+      return 750;
+  }
+}
+
+/**
+ * @name DS18B20_startConversion()
+ * @return uint8_t - the state of the 1-wire line after the bus-reset, 0 if
+ *         devices are present
+ * @brief starts a temperature conversion on all devices at the same time
+ */
+uint8_t DS18B20_startConversion(void)
+{
+  uint8_t result = DS18B20_reset();
+  OW_write(DS18B20_CMD_SKIPROM);
   ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {                                 // the strong pull-up must follow within 10 µs
+    OW_write(DS18B20_CMD_CONVERTTEMP);
+    if (DS_parasite)
+    {
+      OW_strongPullup(1);
+    }
+  }
+  return result;
+}
+
+/**
+ * @name DS18B20_convertDevice()
+ * @param address 64-bit ID address of the device
+ * @return uint8_t - the state of the 1-wire line after the bus-reset, 0 if
+ *         devices are present
+ * @brief starts a temperature conversion on one device
+ */
+uint8_t DS18B20_convertDevice(uint64_t address)
+{
+  uint8_t result = DS18B20_reset();
+  OW_select(address);
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {                                 // the strong pull-up must follow within 10 µs
+    OW_write(DS18B20_CMD_CONVERTTEMP);
+    if (DS_parasite)
+    {
+      OW_strongPullup(1);
+    }
+  }
+  return result;
+}
+
+/**
+ * @name DS18B20_waitConversion()
+ * @param mode DS18B20_WAIT_POLL or DS18B20_WAIT_FIXED
+ * @return none
+ * @brief waits until the conversion started by DS18B20_startConversion()
+ *        has finished, always DS18B20_WAIT_FIXED on a parasite powered bus
+ */
+void DS18B20_waitConversion(uint8_t mode)
+{
+  uint16_t t = DS18B20_conversionTime(DS_resolution);
+
+  if ((mode == DS18B20_WAIT_FIXED) || DS_parasite)
   {
-    do
-    {                                         /* each ROM search pass */
-      DS18B20_reset();
-      DS18B20_write(DS18B20_CMD_SEARCHROM);
-      addr = 0;
-      next=0;                                 /* next path to follow */
-      pos=1;                                  /* path bit pointer */
-      count=0;                                /* count the bits */
-      do
-      {                                       /* each bit of the ROM value */
-        bit = DS18B20_readBit();
-        chk = DS18B20_readBit();
-          if (!bit && !chk)
-          {                                   /* collision, both are zero */
-            if (pos & path)
-            {
-              bit=1;             /* if we've been here before */
-            }
-            else
-            {
-              next=(path&(pos-1))|pos;   /* else, new branch for next */
-            }
-            pos<<=1;
-          }
-          DS18B20_writeBit(bit);
-          addr |= (uint64_t)bit << count;
-          count++;
-      } while (count<64);
-
-      if (numdev < DS_MAX_DEVICES)
+    while (t--)
+    {
+      _delay_ms(1);
+    }
+    OW_strongPullup(0);
+  }
+  else
+  {
+    // the devices answer 0 while converting, never wait longer than the datasheet value;
+    // the end needs two 1-bits in a row, a single disturbed slot must not end the wait
+    while (t--)
+    {
+      if (OW_readBit() && OW_readBit())
       {
-        DS_addresses[numdev] = addr;
-        numdev++;
+        break;
       }
       _delay_ms(1);
-      path=next;
-    } while(path);
-  } // atomic block
-  DS_devcount = numdev;
-  return numdev;
+    }
+  }
 }
 
 /**
- * @name DS18B20_select()
+ * @name DS18B20_crc8()
+ * @param data pointer to the data
+ * @param len number of bytes
+ * @return uint8_t - Dallas/Maxim CRC-8, 0 if data ends with its correct CRC
+ * @brief calculates the CRC-8 (x^8 + x^5 + x^4 + 1) of the 1-wire devices
+ */
+uint8_t DS18B20_crc8(const uint8_t *data, uint8_t len)
+{
+  uint8_t crc = 0;
+
+  while (len--)
+  {
+#if DS_CRC8_TABLE
+    crc = pgm_read_byte(&DS_crc8table[crc ^ *data++]);
+#else
+    crc ^= *data++;
+    crc = (crc >> 4) ^ pgm_read_byte(&DS_crc8nibble[crc & 0x0f]);
+    crc = (crc >> 4) ^ pgm_read_byte(&DS_crc8nibble[crc & 0x0f]);
+#endif
+  }
+  return crc;
+}
+
+/**
+ * @name DS18B20_checkROM()
+ * @param address 64-bit ID address
+ * @return uint8_t - 1 if the CRC in the upper byte is correct
+ * @brief checks the CRC of a ROM code
+ */
+uint8_t DS18B20_checkROM(uint64_t address)
+{
+  uint8_t rom[8];
+
+  if (address == 0)
+  {
+    return 0;     // passes the CRC, but is a shorted bus
+  }
+  for (uint8_t i=0; i<8; i++)
+  {
+    rom[i] = address & 0xff;
+    address >>= 8;
+  }
+  return (DS18B20_crc8(rom, 8) == 0);
+}
+
+/**
+ * @name DS18B20_readScratchpad()
+ * @param address 64-bit ID address of the device, 0 for SKIPROM
+ * @param scratchpad array for the 9 bytes of the scratchpad
+ * @return uint8_t - DS18B20_OK, DS18B20_ERR_PRESENCE or DS18B20_ERR_CRC
+ * @brief reads the complete scratchpad and checks its CRC, failed reads are
+ *        repeated up to DS_RETRIES times
+ */
+uint8_t DS18B20_readScratchpad(uint64_t address, uint8_t *scratchpad)
+{
+  uint8_t result;
+
+  for (uint8_t retry=0; ; retry++)
+  {
+    if (DS18B20_reset() == 0)
+    {
+      if (address == 0)
+      {
+        OW_skip();
+      }
+      else
+      {
+        OW_select(address);
+      }
+      OW_write(DS18B20_CMD_RSCRATCHPAD);
+      OW_readBlock(scratchpad, 9);
+      // the reserved bits of the config byte catch all-0 and all-1 reads
+      if ((DS18B20_crc8(scratchpad, 9) == 0) && ((scratchpad[4] & 0x9f) == 0x1f))
+      {
+        return DS18B20_OK;
+      }
+      DS_stats.crcErrors++;
+      result = DS18B20_ERR_CRC;
+    }
+    else
+    {
+      DS_stats.presenceErrors++;
+      result = DS18B20_ERR_PRESENCE;
+    }
+    if (retry >= DS_RETRIES)
+    {
+      DS_stats.failures++;
+      return result;
+    }
+    DS_stats.retries++;
+    DS18B20_backoff(retry);
+  }
+}
+
+/**
+ * @name DS18B20_write_configDevice()
+ * @param address 64-bit ID address of the device
+ * @param THIGH high-threshold for the alarm
+ * @param TLOW low-threshold for the alarm
+ * @param CONFIG configuration byte for the DS18B20
+ * @return uint8_t - the state of the 1-wire line after the bus-reset, 0 if
+ *         devices are present
+ * @brief writes the configuration part of the scratchpad of one device
+ */
+uint8_t DS18B20_write_configDevice(uint64_t address, int8_t THIGH, int8_t TLOW, uint8_t CONFIG)
+{
+  uint8_t result = DS18B20_reset();
+  OW_select(address);
+  OW_write(DS18B20_CMD_WSCRATCHPAD);
+  OW_write(THIGH);
+  OW_write(TLOW);
+  OW_write(CONFIG);
+  return result;
+}
+
+/**
+ * @name DS18B20_setAlarm()
+ * @param address 64-bit ID address of the device
+ * @param THIGH high-threshold for the alarm in °C
+ * @param TLOW low-threshold for the alarm in °C
+ * @return uint8_t - DS18B20_OK, DS18B20_ERR_PRESENCE or DS18B20_ERR_CRC
+ * @brief sets the alarm thresholds of one device, keeps its resolution
+ */
+uint8_t DS18B20_setAlarm(uint64_t address, int8_t THIGH, int8_t TLOW)
+{
+  uint8_t scratchpad[9];
+  uint8_t result = DS18B20_readScratchpad(address, scratchpad);
+
+  if (result == DS18B20_OK)
+  {
+    DS18B20_write_configDevice(address, THIGH, TLOW, scratchpad[4]);
+  }
+  return result;
+}
+
+/**
+ * @name DS18B20_setResolution()
+ * @param address 64-bit ID address of the device
+ * @param config DS18B20_CFG_9BIT .. DS18B20_CFG_12BIT
+ * @param save 1 to copy the scratchpad into the EEPROM of the device
+ * @return uint8_t - DS18B20_OK, DS18B20_ERR_PRESENCE or DS18B20_ERR_CRC
+ * @brief sets the resolution of one device, keeps its alarm thresholds and
+ *        reads the setting back
+ * @note saving takes 10 ms, on a parasite powered bus with strong pull-up
+ */
+uint8_t DS18B20_setResolution(uint64_t address, uint8_t config, uint8_t save)
+{
+  uint8_t scratchpad[9];
+  uint8_t result = DS18B20_readScratchpad(address, scratchpad);
+
+  if (result != DS18B20_OK)
+  {
+    return result;
+  }
+  config = (scratchpad[4] & ~DS18B20_CFG_gm) | (config & DS18B20_CFG_gm);
+  DS18B20_write_configDevice(address, scratchpad[2], scratchpad[3], config);
+  if (save)
+  {
+    DS18B20_reset();
+    OW_select(address);
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {                               // the strong pull-up must follow within 10 µs
+      OW_write(DS18B20_CMD_CPYSCRATCHPAD);
+      if (DS_parasite)
+      {
+        OW_strongPullup(1);
+      }
+    }
+    _delay_ms(10);
+    OW_strongPullup(0);
+  }
+  result = DS18B20_readScratchpad(address, scratchpad);
+  if ((result == DS18B20_OK) && (scratchpad[4] != config))
+  {
+    result = DS18B20_ERR_CRC;
+  }
+  return result;
+}
+
+/**
+ * @name DS18B20_alarmSearch()
+ * @param list array for the addresses of the devices with an alarm
+ * @param max size of list
+ * @return uint16_t - number of devices with an alarm
+ * @brief finds the devices whose last conversion was outside TLOW..THIGH
+ */
+uint16_t DS18B20_alarmSearch(uint64_t *list, uint16_t max)
+{
+  return DS18B20_search(DS18B20_CMD_ALARMSEARCH, list, max);
+}
+
+/**
+ * @name DS18B20_readAll()
+ * @param temps array of DS_devcount raw temperatures in 1/16 °C
+ * @return uint16_t - number of devices read successfully
+ * @brief reads the temperature of every device in DS_addresses[] back to
+ *        back with DS18B20_readScratchpad(), devices which fail are marked
+ *        with DS18B20_TEMP_INVALID
+ */
+uint16_t DS18B20_readAll(int16_t *temps)
+{
+  uint8_t  scratchpad[9];
+  uint16_t i, count = 0;
+
+  for (i=0; i<DS_devcount; i++)
+  {
+    if (DS18B20_readScratchpad(DS_addresses[i], scratchpad) == DS18B20_OK)
+    {
+      temps[i] = scratchpad[0] | (scratchpad[1] << 8);
+      count++;
+    }
+    else
+    {
+      temps[i] = DS18B20_TEMP_INVALID;
+    }
+  }
+  return count;
+}
+
+/**
+ * @name DS18B20_acquire()
+ * @param temps array of DS_devcount raw temperatures in 1/16 °C
+ * @param mode DS18B20_WAIT_POLL or DS18B20_WAIT_FIXED
+ * @return uint16_t - number of devices read successfully
+ * @brief a complete acquisition cycle: one conversion on all devices,
+ *        waiting for the end of the conversion and reading all devices
+ */
+uint16_t DS18B20_acquire(int16_t *temps, uint8_t mode)
+{
+  if (DS18B20_startConversion())
+  {
+    return 0;     // no devices
+  }
+  DS18B20_waitConversion(mode);
+  return DS18B20_readAll(temps);
+}
+
+/**
+ * @name DS18B20_monitor()
+ * @param mode DS18B20_WAIT_POLL or DS18B20_WAIT_FIXED
+ * @param alarms array for the addresses of the devices with an alarm
+ * @param temps array for the raw temperatures of these devices
+ * @param max size of alarms and temps
+ * @return uint16_t - number of devices with an alarm
+ * @brief a monitoring cycle: one conversion on all devices, then only the
+ *        devices found by the alarm search are read
+ */
+uint16_t DS18B20_monitor(uint8_t mode, uint64_t *alarms, int16_t *temps, uint16_t max)
+{
+  uint8_t  scratchpad[9];
+  uint16_t count;
+
+  if (DS18B20_startConversion())
+  {
+    return 0;     // no devices
+  }
+  DS18B20_waitConversion(mode);
+  count = DS18B20_alarmSearch(alarms, max);
+  for (uint16_t i=0; i<count; i++)
+  {
+    if (DS18B20_readScratchpad(alarms[i], scratchpad) == DS18B20_OK)
+    {
+      temps[i] = scratchpad[0] | (scratchpad[1] << 8);
+    }
+    else
+    {
+      temps[i] = DS18B20_TEMP_INVALID;
+    }
+  }
+  return count;
+}
+
+/**
+ * @name DS18B20_mask()
+ * @param raw temperature in 1/16 °C (Q8.4) as read from the scratchpad
+ * @param config resolution of the device, DS18B20_CFG_9BIT .. 12BIT
+ * @return int16_t - raw with the bits cleared which are undefined at this
+ *         resolution
+ */
+int16_t DS18B20_mask(int16_t raw, uint8_t config)
+{
+  // 9 bit: 3 undefined LSB, 10 bit: 2, 11 bit: 1
+  uint8_t undefined = 3 - ((config & DS18B20_CFG_gm) >> 5);
+  return raw & ~((1 << undefined) - 1);
+}
+
+/**
+ * @name DS18B20_centi()
+ * @param raw temperature in 1/16 °C (Q8.4) as read from the scratchpad
+ * @param config resolution of the device, DS18B20_CFG_9BIT .. 12BIT
+ * @return int16_t - temperature in 1/100 °C, rounded,
+ *         DS18B20_TEMP_INVALID stays invalid
+ * @brief integer conversion, no floating point
+ */
+int16_t DS18B20_centi(int16_t raw, uint8_t config)
+{
+  int32_t t;
+
+  if (raw == DS18B20_TEMP_INVALID)
+  {
+    return raw;
+  }
+  t = (int32_t)DS18B20_mask(raw, config) * 25;  // 100/16 = 25/4
+  return (t + ((t < 0) ? -2 : 2)) / 4;
+}
+
+/**
+ * @name DS18B20_centiArray()
+ * @param raw array of temperatures in 1/16 °C
+ * @param centi array for the temperatures in 1/100 °C, may be raw itself
+ * @param count number of temperatures
+ * @param config resolution of the devices
  * @return none
- * @param address 64-bit ID address of the desired device
- * @brief selects one 1-wire device on the bus for subsequent activities
  */
-void DS18B20_select(uint64_t address)
+void DS18B20_centiArray(const int16_t *raw, int16_t *centi, uint16_t count, uint8_t config)
+{
+  for (uint16_t i=0; i<count; i++)
+  {
+    centi[i] = DS18B20_centi(raw[i], config);
+  }
+}
+
+/**
+ * @name DS18B20_format()
+ * @param centi temperature in 1/100 °C
+ * @param buffer at least 8 characters
+ * @param decimals number of decimals 0..2, rounded
+ * @return char* - buffer, "-12.34", "---" for DS18B20_TEMP_INVALID
+ * @brief small replacement for sprintf() for temperatures
+ */
+char *DS18B20_format(int16_t centi, char *buffer, uint8_t decimals)
 {
-  uint8_t i;
-  DS18B20_write(DS18B20_CMD_MATCHROM);
-  for (i=0; i<64; i++)
+  char     digits[6];
+  char     *p = buffer;
+  uint16_t value;
+  uint8_t  n = 0;
+
+  if (centi == DS18B20_TEMP_INVALID)
+  {
+    strcpy(buffer, "---");
+    return buffer;
+  }
+  value = (centi < 0) ? -(int32_t)centi : centi;
+  if (decimals > 2)
   {
-    DS18B20_writeBit((address >> i) & 0b01);
+    decimals = 2;
+  }
+  if (decimals < 2)
+  {                                 // round away the unused decimals, once
+    value = (value + (decimals ? 5 : 50)) / (decimals ? 10 : 100);
+  }
+  if ((centi < 0) && value)
+  {                                 // no "-0"
+    *p++ = '-';
+  }
+  do
+  {
+    digits[n++] = '0' + value % 10;
+    value /= 10;
+  } while (value || (n <= decimals));
+  while (n)
+  {
+    if (n == decimals)
+    {
+      *p++ = '.';
+    }
+    *p++ = digits[--n];
   }
+  *p = 0;
+  return buffer;
 }
@@ -12,21 +12,99 @@
  * ChangeLog:
  * --------
  * * 2025-07-11 created.
+ * * 2026-10-18 batched conversion and read of all devices
+ * * 2026-10-18 CRC-8 check of ROM codes and scratchpad, retries, error counters
+ * * 2026-10-18 alarm search and per-device alarm thresholds
+ * * 2026-10-18 sorted device table, family and incremental search
+ * * 2026-10-18 insertion and removal in the device table
+ * * 2026-10-18 parasite power detection and strong pull-up
+ * * 2026-10-18 per-device resolution and conversion
+ * * 2026-10-18 integer temperature conversion and formatting
+ * * 2026-10-18 built on the generic 1-wire layer in onewire.c
  */
 
 #ifndef ds18b20_h
 #define ds18b20_h
 
+#include <onewire.h>
 #include <avr/io.h>
 #include <util/delay.h>
 #include <util/atomic.h>
+#include <avr/pgmspace.h>
+#include <string.h>
 
 /**
- * list of found sensors on the 1-wire bus after a DS18B20_scanBus()
+ * list of found sensors on the 1-wire bus after a DS18B20_scanBus(), sorted
+ * in ascending order, 8 bytes of RAM per entry
+ * DS_dropped counts the devices which did not fit into the list
  */
+#ifndef DS_MAX_DEVICES
 #define DS_MAX_DEVICES 10
+#endif
 extern uint64_t DS_addresses[DS_MAX_DEVICES];
 extern uint16_t DS_devcount;
+extern uint16_t DS_dropped;
+
+/**
+ * family code of the DS18B20
+ */
+#define DS18B20_FAMILY 0x28
+
+/**
+ * state of an incremental ROM search, see DS18B20_searchNext()
+ */
+typedef struct
+{
+  uint64_t path;    //!< branches to take in the next pass
+  uint8_t  command; //!< DS18B20_CMD_SEARCHROM or DS18B20_CMD_ALARMSEARCH
+  uint8_t  family;  //!< family code to search for, 0 for all
+  uint8_t  state;   //!< DS_SEARCH_FIRST, DS_SEARCH_RUNNING or DS_SEARCH_DONE
+} DS_search_t;
+
+#define DS_SEARCH_FIRST   0
+#define DS_SEARCH_RUNNING 1
+#define DS_SEARCH_DONE    2
+
+/**
+ * selection of the CRC-8 implementation
+ * 1 - 256 byte table in flash, one lookup per byte
+ * 0 - 16 byte table in flash, two lookups per byte
+ */
+#ifndef DS_CRC8_TABLE
+#define DS_CRC8_TABLE 0
+#endif
+
+/**
+ * number of retries after a failed ROM search pass or scratchpad read, the
+ * pause before retry n is 2^n ms
+ */
+#ifndef DS_RETRIES
+#define DS_RETRIES 3
+#endif
+
+/**
+ * result codes of the checked transfers
+ */
+#define DS18B20_OK           0 //!< data received and CRC correct
+#define DS18B20_ERR_PRESENCE 1 //!< no presence pulse after the bus-reset
+#define DS18B20_ERR_CRC      2 //!< CRC error or implausible data
+
+/**
+ * marker for a temperature which could not be read
+ */
+#define DS18B20_TEMP_INVALID ((int16_t)0x8000)
+
+/**
+ * error counters, cleared only by the application
+ */
+typedef struct
+{
+  uint16_t crcErrors;      //!< ROM codes and scratchpads with bad CRC
+  uint16_t presenceErrors; //!< bus-resets without presence pulse
+  uint16_t retries;        //!< repeated transfers
+  uint16_t failures;       //!< transfers which failed after all retries
+} DS_stats_t;
+extern DS_stats_t DS_stats;
 
 /**
  * command constants for the DS18B20 sensor
@@ -46,11 +124,44 @@ extern uint16_t DS_devcount;
 /**
  * configuration constants for temperature resolution
  */
-#define DS18B20_CFG_9BIT  0b00 << 5 //!< 1/2°C resolution, 9 bits of result, 94 ms
-#define DS18B20_CFG_10BIT 0b01 << 5 //!< 1/4°C resolution, 10 bits of result, 188 ms
-#define DS18B20_CFG_11BIT 0b10 << 5 //!< 1/8°C resolution, 11 bits of result, 375 ms
-#define DS18B20_CFG_12BIT 0b11 << 5 //!< 1/16°C resolution, 12 bits of result, 750 ms
+#define DS18B20_CFG_9BIT  (0b00 << 5) //!< 1/2°C resolution, 9 bits of result, 94 ms
+#define DS18B20_CFG_10BIT (0b01 << 5) //!< 1/4°C resolution, 10 bits of result, 188 ms
+#define DS18B20_CFG_11BIT (0b10 << 5) //!< 1/8°C resolution, 11 bits of result, 375 ms
+#define DS18B20_CFG_12BIT (0b11 << 5) //!< 1/16°C resolution, 12 bits of result, 750 ms
+#define DS18B20_CFG_gm    (0b11 << 5)
+
+/**
+ * resolution of the devices, set by DS18B20_write_config(), used to
+ * calculate the conversion time
+ */
+extern uint8_t DS_resolution;
+
+/**
+ * waiting modes for the end of a conversion
+ */
+#define DS18B20_WAIT_POLL  0 //!< read time slots until the devices report the end
+#define DS18B20_WAIT_FIXED 1 //!< wait the conversion time of DS_resolution
+
+/**
+ * 1 if at least one device on the bus is parasite powered, set by
+ * DS18B20_readPowerSupply(). Parasite powered devices can not answer the
+ * polling during a conversion, DS18B20_waitConversion() always waits the
+ * fixed time and keeps the strong pull-up active.
+ */
+extern uint8_t DS_parasite;
+
+/**
+ * the strong pull-up is configured with OW_SPU_PORT/OW_SPU_PIN_bm in
+ * onewire.h
+ */
 
+/**
+ * @name DS18B20_backoff()
+ * @param retry number of the retry 0..
+ * @brief waits 2^retry ms before a retry
+ * @note internal use
+ */
+void DS18B20_backoff(uint8_t retry);
 
 /**
  * @name DS18B20_init()
@@ -61,51 +172,55 @@ extern uint16_t DS_devcount;
  */
 void DS18B20_init(volatile PORT_t *ds_port, uint8_t pin);
 
+/*
+ * the following functions are kept for existing applications, the bus
+ * access itself is in onewire.c. Every DS18B20 transaction starts with
+ * DS18B20_reset(), which returns the bus to standard speed: devices left in
+ * overdrive by OW_overdriveSkip()/OW_overdriveSelect() fall back as well.
+ */
+
 /**
  * @name DS18B20_set()
- * @brief set the pin to 0 and declare as output
- * @note internal use
+ * @brief see OW_set()
  */
 void DS18B20_set(void);
 
 /**
  * @name DS18B20_release()
- * @brief release the port pin, keep pull-up active
- * @note internal use
+ * @brief see OW_release()
  */
 void DS18B20_release(void);
 
 /**
  * @name DS18B20_get()
- * @param none
- * @return uint8_t state of the pin 1/0
- * @brief reads the state of the 1-wire line, receiving the answer from the device
- * @note internal use
+ * @brief see OW_get()
  */
 uint8_t DS18B20_get(void);
 
+/**
+ * @name DS18B20_strongPullup()
+ * @brief see OW_strongPullup()
+ */
+void DS18B20_strongPullup(uint8_t on);
+
 /**
  * @name DS18B20_reset()
- * @return uint8_t returns the state of the 1-wire line after a bus-reset
- * @brief resets the 1-wire bus devices by pulling the line low for 480 µs
- * @note internal use
+ * @return uint8_t state of the 1-wire line after the bus-reset, 0 if at
+ *         least one device is present
+ * @brief sets OW_speed to OW_SPEED_STANDARD and resets the bus, the
+ *        DS18B20 has no overdrive
  */
 uint8_t DS18B20_reset(void);
 
 /**
  * @name DS18B20_writeBit()
- * @param bit - the bit to write 1/0
- * @return none
- * @brief writes a bit on the 1-wire bus
- * @note internal use
+ * @brief see OW_writeBit()
  */
 void DS18B20_writeBit(uint8_t bit);
 
 /**
  * @name DS18B20_write()
- * @param byte - data to be written to the 1-wire devices
- * @return none
- * @brief writes one byte of data on the 1-wire bus
+ * @brief see OW_write()
  */
 void DS18B20_write(uint8_t byte);
 
@@ -121,19 +236,103 @@ void DS18B20_write_config(int8_t THIGH, int8_t TLOW, uint8_t CONFIG);
 
 /**
  * @name DS18B20_readBit()
- * @return uint8_t - value of the bit 1/0
- * @brief triggers the reading of a single bit from the device
- * @note internal use
+ * @brief see OW_readBit()
  */
 uint8_t DS18B20_readBit(void);
 
 /**
  * @name DS18B20_read()
- * @return uint8_t - value returned by the device, 1 byte
- * @brief triggers the reading of a single byte from the device
+ * @brief see OW_read()
  */
 uint8_t DS18B20_read(void);
 
+/**
+ * @name DS18B20_searchStart()
+ * @param search state of the search
+ * @param command DS18B20_CMD_SEARCHROM or DS18B20_CMD_ALARMSEARCH
+ * @param family family code of the wanted devices, 0 for all devices
+ * @return none
+ * @brief prepares an incremental search, see DS18B20_searchNext()
+ */
+void DS18B20_searchStart(DS_search_t *search, uint8_t command, uint8_t family);
+
+/**
+ * @name DS18B20_searchNext()
+ * @param search state of the search
+ * @param address receives the next ROM code
+ * @return uint8_t - 1 if a device was found, 0 if the search is finished
+ * @brief runs search passes until the next device with a valid ROM code is
+ *        found, passes with CRC errors are repeated up to DS_RETRIES times
+ * @note the interrupts are only disabled during each pass (~13 ms), the
+ *       main loop can do other work between the calls
+ */
+uint8_t DS18B20_searchNext(DS_search_t *search, uint64_t *address);
+
+/**
+ * @name DS18B20_search()
+ * @param command DS18B20_CMD_SEARCHROM or DS18B20_CMD_ALARMSEARCH
+ * @param list array for the found addresses
+ * @param max size of list
+ * @return uint16_t - number of addresses stored in list
+ * @brief the ROM search of DS18B20_scanBus() with a selectable search command
+ */
+uint16_t DS18B20_search(uint8_t command, uint64_t *list, uint16_t max);
+
+/**
+ * @name DS18B20_searchFamily()
+ * @param family family code of the wanted devices, e.g. DS18B20_FAMILY
+ * @param list array for the found addresses
+ * @param max size of list
+ * @return uint16_t - number of addresses stored in list
+ * @brief ROM search which only follows the branches of one family code
+ */
+uint16_t DS18B20_searchFamily(uint8_t family, uint64_t *list, uint16_t max);
+
+/**
+ * @name DS18B20_sort()
+ * @param list array of addresses
+ * @param count number of addresses in list
+ * @return none
+ * @brief sorts a list of addresses in ascending order
+ */
+void DS18B20_sort(uint64_t *list, uint16_t count);
+
+/**
+ * @name DS18B20_find()
+ * @param address 64-bit ID address of a device
+ * @return int16_t - index of the device in DS_addresses[], -1 if unknown
+ * @brief binary search in the sorted device table
+ */
+int16_t DS18B20_find(uint64_t address);
+
+/**
+ * @name DS18B20_insert()
+ * @param address 64-bit ID address of a device
+ * @return int16_t - index of the device in DS_addresses[], -1 if the table
+ *         is full
+ * @brief adds a device to the sorted device table, known devices are not
+ *        added twice
+ */
+int16_t DS18B20_insert(uint64_t address);
+
+/**
+ * @name DS18B20_remove()
+ * @param index index of the device in DS_addresses[]
+ * @return none
+ * @brief removes a device from the sorted device table
+ */
+void DS18B20_remove(uint16_t index);
+
+/**
+ * @name DS18B20_countPrefix()
+ * @param prefix the lower bits of a ROM code
+ * @param bits number of valid bits in prefix 1..64
+ * @return uint16_t - number of devices in DS_addresses[] starting with prefix
+ * @note the search sends the ROM codes LSB first, i.e. the prefix is a
+ *       branch of the search tree
+ */
+uint16_t DS18B20_countPrefix(uint64_t prefix, uint8_t bits);
+
 /**
  * @name DS18B20_scanBus()
  * @return uint16_t - number of discovered devices on the bus
@@ -141,6 +340,12 @@ uint8_t DS18B20_read(void);
  * @brief scans the bus for the IDs of the attached devices
  * 1-wire ROM Search routine
  *
+ * DS_addresses[] is sorted afterwards, see DS18B20_find(). Devices
+ * beyond DS_MAX_DEVICES are counted in DS_dropped.
+ *
+ * Passes which return a ROM code with a bad CRC are repeated up to
+ * DS_RETRIES times, ROM codes which never pass the check are dropped.
+ *
  * This is an alternative to the published routine. It is
  * not faster than the publshed routine (the number of
  * passes is the same), but it may be easier to implement in
@@ -152,10 +357,10 @@ uint8_t DS18B20_read(void);
  * If there are N devices, this number of bits is at least
  * log_2(N) and not more than N-1 (and not more than 56).
  *
- * This routine does not admit the possibility that the two
- * bits read from the bus are both 1. This would only happen
- * in the event of an error after device presence has been
- * obtained.
+ * The two bits read from the bus are both 1 only if no device
+ * takes part in the search, e.g. in an alarm search without
+ * alarms. A pass which ends this way is treated like a pass
+ * with a CRC error, unless it is the very first pass.
  *
  * The variable 'path' contains sufficient information to
  * conduct one pass. The results of previous passes are not
@@ -170,10 +375,197 @@ uint16_t DS18B20_scanBus(void);
 
 /**
  * @name DS18B20_select()
- * @return none
- * @param address 64-bit ID address of the desired device
- * @brief selects one 1-wire device on the bus for subsequent activities
+ * @brief see OW_select()
  */
 void DS18B20_select(uint64_t address);
 
+/**
+ * @name DS18B20_readPowerSupply()
+ * @return uint8_t - 1 if at least one device is parasite powered
+ * @brief asks all devices for their power supply (READ POWER SUPPLY, 0xB4),
+ *        sets DS_parasite
+ */
+uint8_t DS18B20_readPowerSupply(void);
+
+/**
+ * @name DS18B20_conversionTime()
+ * @param config configuration byte, only the resolution bits are used
+ * @return uint16_t - maximum conversion time in ms
+ * @brief conversion time from the datasheet for the given resolution
+ */
+uint16_t DS18B20_conversionTime(uint8_t config);
+
+/**
+ * @name DS18B20_startConversion()
+ * @return uint8_t - the state of the 1-wire line after the bus-reset, 0 if
+ *         devices are present
+ * @brief starts a temperature conversion on all devices at the same time
+ */
+uint8_t DS18B20_startConversion(void);
+
+/**
+ * @name DS18B20_convertDevice()
+ * @param address 64-bit ID address of the device
+ * @return uint8_t - the state of the 1-wire line after the bus-reset, 0 if
+ *         devices are present
+ * @brief starts a temperature conversion on one device
+ */
+uint8_t DS18B20_convertDevice(uint64_t address);
+
+/**
+ * @name DS18B20_waitConversion()
+ * @param mode DS18B20_WAIT_POLL or DS18B20_WAIT_FIXED
+ * @return none
+ * @brief waits until the conversion started by DS18B20_startConversion()
+ *        has finished, always DS18B20_WAIT_FIXED on a parasite powered bus
+ */
+void DS18B20_waitConversion(uint8_t mode);
+
+/**
+ * @name DS18B20_crc8()
+ * @param data pointer to the data
+ * @param len number of bytes
+ * @return uint8_t - Dallas/Maxim CRC-8, 0 if data ends with its correct CRC
+ * @brief calculates the CRC-8 (x^8 + x^5 + x^4 + 1) of the 1-wire devices
+ */
+uint8_t DS18B20_crc8(const uint8_t *data, uint8_t len);
+
+/**
+ * @name DS18B20_checkROM()
+ * @param address 64-bit ID address
+ * @return uint8_t - 1 if the CRC in the upper byte is correct
+ * @brief checks the CRC of a ROM code
+ */
+uint8_t DS18B20_checkROM(uint64_t address);
+
+/**
+ * @name DS18B20_readScratchpad()
+ * @param address 64-bit ID address of the device, 0 for SKIPROM
+ * @param scratchpad array for the 9 bytes of the scratchpad
+ * @return uint8_t - DS18B20_OK, DS18B20_ERR_PRESENCE or DS18B20_ERR_CRC
+ * @brief reads the complete scratchpad and checks its CRC, failed reads are
+ *        repeated up to DS_RETRIES times
+ */
+uint8_t DS18B20_readScratchpad(uint64_t address, uint8_t *scratchpad);
+
+/**
+ * @name DS18B20_write_configDevice()
+ * @param address 64-bit ID address of the device
+ * @param THIGH high-threshold for the alarm
+ * @param TLOW low-threshold for the alarm
+ * @param CONFIG configuration byte for the DS18B20
+ * @return uint8_t - the state of the 1-wire line after the bus-reset, 0 if
+ *         devices are present
+ * @brief writes the configuration part of the scratchpad of one device
+ */
+uint8_t DS18B20_write_configDevice(uint64_t address, int8_t THIGH, int8_t TLOW, uint8_t CONFIG);
+
+/**
+ * @name DS18B20_setAlarm()
+ * @param address 64-bit ID address of the device
+ * @param THIGH high-threshold for the alarm in °C
+ * @param TLOW low-threshold for the alarm in °C
+ * @return uint8_t - DS18B20_OK, DS18B20_ERR_PRESENCE or DS18B20_ERR_CRC
+ * @brief sets the alarm thresholds of one device, keeps its resolution
+ * @note the thresholds are lost at power-down unless copied to the EEPROM
+ *       of the device
+ */
+uint8_t DS18B20_setAlarm(uint64_t address, int8_t THIGH, int8_t TLOW);
+
+/**
+ * @name DS18B20_setResolution()
+ * @param address 64-bit ID address of the device
+ * @param config DS18B20_CFG_9BIT .. DS18B20_CFG_12BIT
+ * @param save 1 to copy the scratchpad into the EEPROM of the device
+ * @return uint8_t - DS18B20_OK, DS18B20_ERR_PRESENCE or DS18B20_ERR_CRC
+ * @brief sets the resolution of one device, keeps its alarm thresholds and
+ *        reads the setting back
+ * @note saving takes 10 ms, on a parasite powered bus with strong pull-up
+ */
+uint8_t DS18B20_setResolution(uint64_t address, uint8_t config, uint8_t save);
+
+/**
+ * @name DS18B20_alarmSearch()
+ * @param list array for the addresses of the devices with an alarm
+ * @param max size of list
+ * @return uint16_t - number of devices with an alarm
+ * @brief finds the devices whose last conversion was outside TLOW..THIGH
+ */
+uint16_t DS18B20_alarmSearch(uint64_t *list, uint16_t max);
+
+/**
+ * @name DS18B20_readAll()
+ * @param temps array of DS_devcount raw temperatures in 1/16 °C
+ * @return uint16_t - number of devices read successfully
+ * @brief reads the temperature of every device in DS_addresses[] back to
+ *        back with DS18B20_readScratchpad(), devices which fail are marked
+ *        with DS18B20_TEMP_INVALID
+ */
+uint16_t DS18B20_readAll(int16_t *temps);
+
+/**
+ * @name DS18B20_acquire()
+ * @param temps array of DS_devcount raw temperatures in 1/16 °C
+ * @param mode DS18B20_WAIT_POLL or DS18B20_WAIT_FIXED
+ * @return uint16_t - number of devices read successfully
+ * @brief a complete acquisition cycle: one conversion on all devices,
+ *        waiting for the end of the conversion and reading all devices
+ * @note use DS18B20_startConversion() and DS18B20_readAll() separately to
+ *       do other work during the conversion
+ */
+uint16_t DS18B20_acquire(int16_t *temps, uint8_t mode);
+
+/**
+ * @name DS18B20_monitor()
+ * @param mode DS18B20_WAIT_POLL or DS18B20_WAIT_FIXED
+ * @param alarms array for the addresses of the devices with an alarm
+ * @param temps array for the raw temperatures of these devices
+ * @param max size of alarms and temps
+ * @return uint16_t - number of devices with an alarm
+ * @brief a monitoring cycle: one conversion on all devices, then only the
+ *        devices found by the alarm search are read
+ * @note the cost of a cycle grows with the number of alarms, not with the
+ *       number of devices on the bus
+ */
+uint16_t DS18B20_monitor(uint8_t mode, uint64_t *alarms, int16_t *temps, uint16_t max);
+
+/**
+ * @name DS18B20_mask()
+ * @param raw temperature in 1/16 °C (Q8.4) as read from the scratchpad
+ * @param config resolution of the device, DS18B20_CFG_9BIT .. 12BIT
+ * @return int16_t - raw with the bits cleared which are undefined at this
+ *         resolution
+ */
+int16_t DS18B20_mask(int16_t raw, uint8_t config);
+
+/**
+ * @name DS18B20_centi()
+ * @param raw temperature in 1/16 °C (Q8.4) as read from the scratchpad
+ * @param config resolution of the device, DS18B20_CFG_9BIT .. 12BIT
+ * @return int16_t - temperature in 1/100 °C, rounded,
+ *         DS18B20_TEMP_INVALID stays invalid
+ * @brief integer conversion, no floating point
+ */
+int16_t DS18B20_centi(int16_t raw, uint8_t config);
+
+/**
+ * @name DS18B20_centiArray()
+ * @param raw array of temperatures in 1/16 °C
+ * @param centi array for the temperatures in 1/100 °C, may be raw itself
+ * @param count number of temperatures
+ * @param config resolution of the devices
+ * @return none
+ */
+void DS18B20_centiArray(const int16_t *raw, int16_t *centi, uint16_t count, uint8_t config);
+
+/**
+ * @name DS18B20_format()
+ * @param centi temperature in 1/100 °C
+ * @param buffer at least 8 characters
+ * @param decimals number of decimals 0..2, rounded
+ * @return char* - buffer, "-12.34", "---" for DS18B20_TEMP_INVALID
+ * @brief small replacement for sprintf() for temperatures
+ */
+char *DS18B20_format(int16_t centi, char *buffer, uint8_t decimals);
+
 #endif
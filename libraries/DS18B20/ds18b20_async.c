@@ -0,0 +1,137 @@
+/**
+ * @file ds18b20_async.c
+ * @brief byte and block transfers of the asynchronous 1-wire interface
+ *
+ * @author Uwe Zimmermann
+ *
+ * The library work is licensed under a MIT license.\n
+ * See https://github.com/uwezi/AVR-Dx
+ *
+ * The part of the asynchronous interface which is the same for all back
+ * ends: the state of a transfer and the byte and block functions. The back
+ * end (ds18b20_tcb.c or ds18b20_usart.c) generates the time slots and
+ * provides DS18B20_asyncBegin() and DS18B20_asyncReset().
+ *
+ * ChangeLog:
+ * --------
+ * * 2026-10-18 created from ds18b20_tcb.c and ds18b20_usart.c
+ */
+
+#include <ds18b20_async.h>
+
+/**
+ * @brief globals of the engine
+ * @note internal use
+ */
+volatile uint8_t DS_asyncState = DS_STATE_IDLE;
+uint8_t  *DS_asyncBuf;     // current position in the block
+uint8_t  DS_asyncLen;      // bytes left in the block
+uint8_t  DS_asyncByte;     // shift register of the current byte
+uint8_t  DS_asyncBit;      // bit counter of the current byte
+uint8_t  DS_asyncReading;  // 1: read slots, 0: write slots
+uint8_t  DS_asyncSingle;   // storage for single byte transfers
+DS_callback_t DS_asyncDone;
+DS_callback_t DS_asyncUserDone; // application callback of DS18B20_asyncRead()
+
+/**
+ * @name DS18B20_asyncBusy()
+ * @return uint8_t - 1 while a transfer is running
+ */
+uint8_t DS18B20_asyncBusy(void)
+{
+  return (DS_asyncState != DS_STATE_IDLE);
+}
+
+/**
+ * @name DS18B20_asyncTransfer()
+ * @brief common part of all byte and block transfers
+ * @note internal use
+ */
+static uint8_t DS18B20_asyncTransfer(uint8_t *buf, uint8_t len, uint8_t reading, DS_callback_t done)
+{
+  if (DS18B20_asyncBusy() || (len == 0))
+  {
+    return 1;
+  }
+  DS_asyncDone = done;
+  DS_asyncBuf = buf;
+  DS_asyncLen = len;
+  DS_asyncBit = 0;
+  DS_asyncReading = reading;
+  DS_asyncByte = reading ? 0 : *buf;
+  DS18B20_asyncBegin();
+  return 0;
+}
+
+/**
+ * @name DS18B20_asyncSingleDone()
+ * @brief hands the byte of a single read to the callback of the application
+ * @note internal use
+ */
+static void DS18B20_asyncSingleDone(uint8_t result)
+{
+  (void)result;                     // always DS_ASYNC_OK after read slots
+  if (DS_asyncUserDone)
+  {
+    DS_asyncUserDone(DS_asyncSingle);
+  }
+}
+
+/**
+ * @name DS18B20_asyncWrite()
+ * @param byte - data to be written to the 1-wire devices
+ * @param done - callback, may be NULL
+ * @return uint8_t - 0 if started, 1 if the engine is busy
+ * @brief starts writing one byte on the 1-wire bus
+ */
+uint8_t DS18B20_asyncWrite(uint8_t byte, DS_callback_t done)
+{
+  if (DS18B20_asyncBusy())
+  {
+    return 1;
+  }
+  DS_asyncSingle = byte;
+  return DS18B20_asyncTransfer(&DS_asyncSingle, 1, 0, done);
+}
+
+/**
+ * @name DS18B20_asyncRead()
+ * @param done - callback, receives the byte read from the bus
+ * @return uint8_t - 0 if started, 1 if the engine is busy
+ * @brief starts reading one byte from the 1-wire bus
+ */
+uint8_t DS18B20_asyncRead(DS_callback_t done)
+{
+  if (DS18B20_asyncBusy())
+  {
+    return 1;
+  }
+  DS_asyncUserDone = done;
+  return DS18B20_asyncTransfer(&DS_asyncSingle, 1, 1, DS18B20_asyncSingleDone);
+}
+
+/**
+ * @name DS18B20_asyncWriteBlock()
+ * @param buf - data to be written, must stay valid until done
+ * @param len - number of bytes 1..255
+ * @param done - callback, may be NULL
+ * @return uint8_t - 0 if started, 1 if the engine is busy
+ * @brief starts writing a block of bytes on the 1-wire bus
+ */
+uint8_t DS18B20_asyncWriteBlock(const uint8_t *buf, uint8_t len, DS_callback_t done)
+{
+  return DS18B20_asyncTransfer((uint8_t *)buf, len, 0, done);
+}
+
+/**
+ * @name DS18B20_asyncReadBlock()
+ * @param buf - buffer for the received data
+ * @param len - number of bytes 1..255
+ * @param done - callback, may be NULL
+ * @return uint8_t - 0 if started, 1 if the engine is busy
+ * @brief starts reading a block of bytes from the 1-wire bus
+ */
+uint8_t DS18B20_asyncReadBlock(uint8_t *buf, uint8_t len, DS_callback_t done)
+{
+  return DS18B20_asyncTransfer(buf, len, 1, done);
+}
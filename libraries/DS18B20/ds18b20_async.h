@@ -0,0 +1,167 @@
+/**
+ * @file ds18b20_async.h
+ * @brief non-blocking 1-wire transfers for the DS18B20 library
+ *
+ * @author Uwe Zimmermann
+ *
+ * The library work is licensed under a MIT license.\n
+ * See https://github.com/uwezi/AVR-Dx
+ *
+ * The blocking routines in ds18b20.c spin in _delay_us() for every bit and
+ * keep the interrupts disabled for whole bytes. The functions declared here
+ * start a transfer and return immediately, the time slots are generated from
+ * an interrupt and a callback is called when the transfer has finished.
+ *
+ * ds18b20_async.c holds the byte and block functions. There are two back
+ * ends generating the time slots, link exactly one of them with it:
+ * - ds18b20_tcb.c - a state machine driven by the compare interrupt of a
+ *   TCB, the 1-wire pin is the one given to DS18B20_asyncInit().
+ *   Interrupts are only masked inside the ISR, i.e. ~1 µs for a written bit
+ *   and ~12 µs for a read bit.
+ * - ds18b20_usart.c - a USART in one-wire (loop-back, open-drain) mode, every
+ *   time slot is one character at 115200 baud and a reset is one character at
+ *   9600 baud. The timing is done by the USART, one short ISR per bit.
+ *   Initialized with DS18B20_asyncInitUSART(), the 1-wire bus is connected
+ *   to the TX pin of the USART.
+ *
+ * The callbacks are called from interrupt context and may start the next
+ * transfer right away. The blocking functions must not be used while an
+ * asynchronous transfer is running.
+ *
+ * ChangeLog:
+ * --------
+ * * 2026-10-18 created.
+ * * 2026-10-18 added USART back end
+ * * 2026-10-18 byte and block functions moved to ds18b20_async.c
+ */
+
+#ifndef ds18b20_async_h
+#define ds18b20_async_h
+
+#include <ds18b20.h>
+#include <avr/interrupt.h>
+
+/**
+ * @brief hardware parameters of the TCB back end
+ */
+#define DS_TCB        TCB0
+#define DS_TCB_INTVEC TCB0_INT_vect
+
+/**
+ * @brief hardware parameters of the USART back end
+ * @note the TX pin is used in open-drain mode, keep the external pull-up
+ */
+#define DS_UART             USART1
+#define DS_UART_INTVEC      USART1_RXC_vect
+#define DS_UART_ROUTEREG    PORTMUX_USARTROUTEA
+#define DS_UART_PINROUTE_gm PORTMUX_USART1_gm
+#define DS_UART_PINROUTE_gc PORTMUX_USART1_DEFAULT_gc
+#define DS_UART_XDIRSET     PORTC.DIRSET = PIN0_bm;
+#define DS_UART_TXPINPULLUP PORTC.PIN0CTRL = PORT_PULLUPEN_bm;
+#define DS_UART_BAUD_CALC(BAUD_RATE) \
+    ((float) ( F_CPU * 64 /  ( 16 * (float)BAUD_RATE )) + 0.5 )
+
+/**
+ * @brief result codes handed to the callbacks
+ */
+#define DS_ASYNC_OK         0 //!< transfer finished, or presence pulse seen after a reset
+#define DS_ASYNC_NOPRESENCE 1 //!< no device answered the reset
+
+/**
+ * @brief completion callback, result is DS_ASYNC_OK/DS_ASYNC_NOPRESENCE or
+ *        the received byte for DS18B20_asyncRead()
+ */
+typedef void (*DS_callback_t)(uint8_t result);
+
+/**
+ * @name DS18B20_asyncInit()
+ * @param ds_port - PORT-module for the 1-wire devices
+ * @param pin - PIN number for the 1-wire devices 0..7
+ * @return none
+ * @brief initialize the 1-wire pin and the timer of the asynchronous engine
+ * @note TCB back end only, calls DS18B20_init(), enables the interrupts
+ */
+void DS18B20_asyncInit(volatile PORT_t *ds_port, uint8_t pin);
+
+/**
+ * @name DS18B20_asyncInitUSART()
+ * @return none
+ * @brief initialize the USART of the asynchronous engine, see DS_UART
+ * @note USART back end only, enables the interrupts
+ */
+void DS18B20_asyncInitUSART(void);
+
+/**
+ * @name DS18B20_asyncBusy()
+ * @return uint8_t - 1 while a transfer is running
+ */
+uint8_t DS18B20_asyncBusy(void);
+
+/**
+ * @name DS18B20_asyncReset()
+ * @param done - callback, receives DS_ASYNC_OK if a device answered
+ * @return uint8_t - 0 if started, 1 if the engine is busy
+ * @brief starts a bus reset with presence detection
+ */
+uint8_t DS18B20_asyncReset(DS_callback_t done);
+
+/**
+ * @name DS18B20_asyncWrite()
+ * @param byte - data to be written to the 1-wire devices
+ * @param done - callback, may be NULL
+ * @return uint8_t - 0 if started, 1 if the engine is busy
+ * @brief starts writing one byte on the 1-wire bus
+ */
+uint8_t DS18B20_asyncWrite(uint8_t byte, DS_callback_t done);
+
+/**
+ * @name DS18B20_asyncRead()
+ * @param done - callback, receives the byte read from the bus
+ * @return uint8_t - 0 if started, 1 if the engine is busy
+ * @brief starts reading one byte from the 1-wire bus
+ */
+uint8_t DS18B20_asyncRead(DS_callback_t done);
+
+/**
+ * @name DS18B20_asyncWriteBlock()
+ * @param buf - data to be written, must stay valid until done
+ * @param len - number of bytes 1..255
+ * @param done - callback, may be NULL
+ * @return uint8_t - 0 if started, 1 if the engine is busy
+ * @brief starts writing a block of bytes on the 1-wire bus
+ */
+uint8_t DS18B20_asyncWriteBlock(const uint8_t *buf, uint8_t len, DS_callback_t done);
+
+/**
+ * @name DS18B20_asyncReadBlock()
+ * @param buf - buffer for the received data
+ * @param len - number of bytes 1..255
+ * @param done - callback, may be NULL
+ * @return uint8_t - 0 if started, 1 if the engine is busy
+ * @brief starts reading a block of bytes from the 1-wire bus
+ */
+uint8_t DS18B20_asyncReadBlock(uint8_t *buf, uint8_t len, DS_callback_t done);
+
+/**
+ * @brief state of the transfer shared by ds18b20_async.c and the back end
+ * @note internal use, the back ends number their other states from 1
+ */
+#define DS_STATE_IDLE 0
+
+extern volatile uint8_t DS_asyncState;
+extern uint8_t       *DS_asyncBuf;
+extern uint8_t       DS_asyncLen;
+extern uint8_t       DS_asyncByte;
+extern uint8_t       DS_asyncBit;
+extern uint8_t       DS_asyncReading;
+extern DS_callback_t DS_asyncDone;
+
+/**
+ * @name DS18B20_asyncBegin()
+ * @return none
+ * @brief starts the first time slot of a transfer prepared in the globals
+ * @note internal use, implemented by the back end
+ */
+void DS18B20_asyncBegin(void);
+
+#endif
@@ -0,0 +1,152 @@
+/**
+ * @file ds18b20_cache.c
+ * @brief persistent list of the 1-wire devices for the DS18B20 library
+ *
+ * @author Uwe Zimmermann
+ *
+ * The library work is licensed under a MIT license.\n
+ * See https://github.com/uwezi/AVR-Dx
+ *
+ * See ds18b20_cache.h
+ *
+ * ChangeLog:
+ * --------
+ * * 2026-10-18 created.
+ * * 2026-10-18 binary search in the sorted device table
+ * * 2026-10-18 DS18B20_countPrefix() moved to ds18b20.c
+ * * 2026-10-18 bus access through onewire.c
+ */
+
+#include <ds18b20_cache.h>
+
+/**
+ * @brief the list in EEPROM, every ROM code carries its own CRC
+ */
+EEMEM uint16_t DS_cacheMagic;
+EEMEM uint16_t DS_cacheCount;
+EEMEM uint64_t DS_cacheAddresses[DS_MAX_DEVICES];
+
+#if defined(EEPROM_SIZE) && ((DS_MAX_DEVICES * 8 + 4) > EEPROM_SIZE)
+#error "DS_MAX_DEVICES too large for the EEPROM, the cache needs 8 bytes per device"
+#endif
+
+/**
+ * @name DS18B20_cacheLoad()
+ * @return uint16_t - number of devices loaded into DS_addresses[]
+ * @brief loads the stored list of devices, DS_devcount is 0 if the EEPROM
+ *        holds no valid list
+ */
+uint16_t DS18B20_cacheLoad(void)
+{
+  uint16_t count;
+
+  DS_devcount = 0;
+  if (eeprom_read_word(&DS_cacheMagic) != DS_CACHE_MAGIC)
+  {
+    return 0;
+  }
+  count = eeprom_read_word(&DS_cacheCount);
+  if (count > DS_MAX_DEVICES)
+  {
+    return 0;
+  }
+  eeprom_read_block(DS_addresses, DS_cacheAddresses, count * sizeof(uint64_t));
+  for (uint16_t i=0; i<count; i++)
+  {
+    if (!DS18B20_checkROM(DS_addresses[i]) ||
+        ((i > 0) && (DS_addresses[i-1] >= DS_addresses[i])))
+    {                                   /* DS18B20_find() needs a sorted list */
+      return 0;
+    }
+  }
+  DS_devcount = count;
+  return count;
+}
+
+/**
+ * @name DS18B20_cacheStore()
+ * @return none
+ * @brief stores DS_addresses[] in EEPROM, unchanged bytes are not written
+ */
+void DS18B20_cacheStore(void)
+{
+  eeprom_update_word(&DS_cacheMagic, DS_CACHE_MAGIC);
+  eeprom_update_word(&DS_cacheCount, DS_devcount);
+  eeprom_update_block(DS_addresses, DS_cacheAddresses, DS_devcount * sizeof(uint64_t));
+}
+
+/**
+ * @name DS18B20_probe()
+ * @return uint64_t - ROM code found by the probe, 0 if no device answered
+ * @brief one search pass which prefers the branches with the fewest known
+ *        devices in DS_addresses[]
+ */
+uint64_t DS18B20_probe(void)
+{
+  uint64_t addr = 0;
+  uint8_t  bit, chk;
+
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    if (DS18B20_reset() != 0)
+    {
+      return 0;
+    }
+    OW_write(DS18B20_CMD_SEARCHROM);
+    for (uint8_t count=0; count<64; count++)
+    {
+      bit = OW_readBit();
+      chk = OW_readBit();
+      if (bit && chk)
+      {                                   /* devices vanished */
+        return 0;
+      }
+      if (!bit && !chk)
+      {                                   /* collision, go where we know less */
+        bit = (DS18B20_countPrefix(addr | ((uint64_t)1 << count), count+1)
+               < DS18B20_countPrefix(addr, count+1)) ? 1 : 0;
+      }
+      OW_writeBit(bit);
+      addr |= (uint64_t)bit << count;
+    }
+  }
+  return addr;
+}
+
+/**
+ * @name DS18B20_startup()
+ * @return uint16_t - number of devices in DS_addresses[]
+ * @brief fills DS_addresses[] from the stored list if all stored devices
+ *        answer and the probe finds no unknown device, otherwise runs
+ *        DS18B20_scanBus() and stores the new list
+ */
+uint16_t DS18B20_startup(void)
+{
+  uint8_t  scratchpad[9];
+  uint8_t  valid;
+  uint64_t probe;
+
+  valid = (DS18B20_cacheLoad() > 0);
+  for (uint16_t i=0; valid && (i<DS_devcount); i++)
+  {
+    valid = (DS18B20_readScratchpad(DS_addresses[i], scratchpad) == DS18B20_OK);
+  }
+  if (valid)
+  {
+    probe = DS18B20_probe();
+    valid = DS18B20_checkROM(probe) && (DS18B20_find(probe) >= 0);
+  }
+  if (!valid)
+  {
+    if (DS18B20_reset() == 0)
+    {
+      DS18B20_scanBus();
+    }
+    else
+    {
+      DS_devcount = 0;
+    }
+    DS18B20_cacheStore();
+  }
+  return DS_devcount;
+}
@@ -0,0 +1,71 @@
+/**
+ * @file ds18b20_cache.h
+ * @brief persistent list of the 1-wire devices for the DS18B20 library
+ *
+ * @author Uwe Zimmermann
+ *
+ * The library work is licensed under a MIT license.\n
+ * See https://github.com/uwezi/AVR-Dx
+ *
+ * The ROM codes found by DS18B20_scanBus() are stored in EEPROM. At the next
+ * start DS18B20_startup() only verifies the stored devices by reading their
+ * scratchpads (MATCHROM, ~6 ms per device) and runs one probing search pass
+ * towards the branches of the search tree which hold no known device. The
+ * full ROM search (~13 ms per device) is only needed if a stored device is
+ * missing or the probe finds an unknown device.
+ *
+ * The probe takes one branch at every collision, a new device which shares
+ * all branch points with known devices is only found by a full search -
+ * call DS18B20_scanBus() and DS18B20_cacheStore() after changing sensors,
+ * or let ds18b20_hotplug.c track the changes at runtime.
+ *
+ * ChangeLog:
+ * --------
+ * * 2026-10-18 created.
+ * * 2026-10-18 reference to ds18b20_hotplug.c
+ */
+
+#ifndef ds18b20_cache_h
+#define ds18b20_cache_h
+
+#include <ds18b20.h>
+#include <avr/eeprom.h>
+
+/**
+ * @brief marker for a valid list in EEPROM
+ */
+#define DS_CACHE_MAGIC 0xd518
+
+/**
+ * @name DS18B20_cacheLoad()
+ * @return uint16_t - number of devices loaded into DS_addresses[]
+ * @brief loads the stored list of devices, DS_devcount is 0 if the EEPROM
+ *        holds no valid list
+ */
+uint16_t DS18B20_cacheLoad(void);
+
+/**
+ * @name DS18B20_cacheStore()
+ * @return none
+ * @brief stores DS_addresses[] in EEPROM, unchanged bytes are not written
+ */
+void DS18B20_cacheStore(void);
+
+/**
+ * @name DS18B20_probe()
+ * @return uint64_t - ROM code found by the probe, 0 if no device answered
+ * @brief one search pass which prefers the branches with the fewest known
+ *        devices in DS_addresses[]
+ */
+uint64_t DS18B20_probe(void);
+
+/**
+ * @name DS18B20_startup()
+ * @return uint16_t - number of devices in DS_addresses[]
+ * @brief fills DS_addresses[] from the stored list if all stored devices
+ *        answer and the probe finds no unknown device, otherwise runs
+ *        DS18B20_scanBus() and stores the new list
+ */
+uint16_t DS18B20_startup(void);
+
+#endif
@@ -0,0 +1,164 @@
+/**
+ * @file ds18b20_history.c
+ * @brief per-sensor history of temperature readings for the DS18B20 library
+ *
+ * @author Uwe Zimmermann
+ *
+ * The library work is licensed under a MIT license.\n
+ * See https://github.com/uwezi/AVR-Dx
+ *
+ * See ds18b20_history.h
+ *
+ * ChangeLog:
+ * --------
+ * * 2026-10-18 created.
+ */
+
+#include <ds18b20_history.h>
+
+/**
+ * @brief globals
+ */
+DS_history_t DS_history[DS_HIST_SENSORS];
+
+/**
+ * @name DS18B20_historyStore()
+ * @param h - history of the sensor
+ * @param tier - tier of the finished aggregate
+ * @param accu - the finished aggregate
+ * @brief writes a finished aggregate into the ring of its tier
+ * @note internal use
+ */
+static void DS18B20_historyStore(DS_history_t *h, uint8_t tier, const DS_accu_t *accu)
+{
+  DS_aggregate_t *a = &h->tiers[tier][h->tierHead[tier]];
+  int32_t half = accu->count / 2;
+
+  a->time = accu->period;
+  a->min  = accu->min;
+  a->max  = accu->max;
+  a->mean = (accu->sum + ((accu->sum < 0) ? -half : half)) / (int32_t)accu->count;
+  if (++h->tierHead[tier] == DS_HIST_DEPTH)
+  {
+    h->tierHead[tier] = 0;
+  }
+  if (h->tierCount[tier] < DS_HIST_DEPTH)
+  {
+    h->tierCount[tier]++;
+  }
+}
+
+/**
+ * @name DS18B20_historyInit()
+ * @return none
+ * @brief clears the history of all sensors
+ */
+void DS18B20_historyInit(void)
+{
+  memset(DS_history, 0, sizeof(DS_history));
+}
+
+/**
+ * @name DS18B20_historyAdd()
+ * @param sensor - number of the sensor 0..DS_HIST_SENSORS-1
+ * @param now - time stamp of the reading in ms, must not go backwards
+ * @param value - the reading
+ * @return none
+ * @brief stores a reading and updates the aggregates, O(1)
+ */
+void DS18B20_historyAdd(uint8_t sensor, uint32_t now, int16_t value)
+{
+  DS_history_t *h;
+  DS_accu_t    in, done, *accu;
+
+  if ((sensor >= DS_HIST_SENSORS) || (value == DS18B20_TEMP_INVALID))
+  {
+    return;
+  }
+  h = &DS_history[sensor];
+  h->samples[h->sampleHead].time  = now;
+  h->samples[h->sampleHead].value = value;
+  if (++h->sampleHead == DS_HIST_SAMPLES)
+  {
+    h->sampleHead = 0;
+  }
+  if (h->sampleCount < DS_HIST_SAMPLES)
+  {
+    h->sampleCount++;
+  }
+
+  // the reading as an aggregate of its own second
+  in.period = now / 1000;
+  in.sum = value;
+  in.count = 1;
+  in.min = value;
+  in.max = value;
+
+  for (uint8_t tier=0; tier<DS_HIST_TIERS; tier++)
+  {
+    accu = &h->accu[tier];
+    if (accu->count && (accu->period == in.period))
+    {                                   // same period, merge and done
+      accu->sum += in.sum;
+      accu->count += in.count;
+      if (in.min < accu->min)
+      {
+        accu->min = in.min;
+      }
+      if (in.max > accu->max)
+      {
+        accu->max = in.max;
+      }
+      return;
+    }
+    done = *accu;
+    *accu = in;
+    if (!done.count)
+    {                                   // first data of this tier
+      return;
+    }
+    // the period is over: store it and hand it on to the next tier
+    DS18B20_historyStore(h, tier, &done);
+    in = done;
+    in.period = done.period / 60;
+  }
+}
+
+/**
+ * @name DS18B20_historySample()
+ * @param sensor - number of the sensor
+ * @param age - 0 for the latest reading, 1 for the one before, ...
+ * @param sample - receives the reading
+ * @return uint8_t - 1 if the reading exists
+ */
+uint8_t DS18B20_historySample(uint8_t sensor, uint8_t age, DS_sample_t *sample)
+{
+  DS_history_t *h = &DS_history[sensor];
+
+  if ((sensor >= DS_HIST_SENSORS) || (age >= h->sampleCount))
+  {
+    return 0;
+  }
+  *sample = h->samples[(h->sampleHead + DS_HIST_SAMPLES - 1 - age) % DS_HIST_SAMPLES];
+  return 1;
+}
+
+/**
+ * @name DS18B20_historyGet()
+ * @param sensor - number of the sensor
+ * @param tier - DS_HIST_SECONDS, DS_HIST_MINUTES or DS_HIST_HOURS
+ * @param age - 0 for the latest complete aggregate, 1 for the one before, ...
+ * @param aggregate - receives minimum, maximum and mean
+ * @return uint8_t - 1 if the aggregate exists
+ */
+uint8_t DS18B20_historyGet(uint8_t sensor, uint8_t tier, uint8_t age, DS_aggregate_t *aggregate)
+{
+  DS_history_t *h = &DS_history[sensor];
+
+  if ((sensor >= DS_HIST_SENSORS) || (tier >= DS_HIST_TIERS) || (age >= h->tierCount[tier]))
+  {
+    return 0;
+  }
+  *aggregate = h->tiers[tier][(h->tierHead[tier] + DS_HIST_DEPTH - 1 - age) % DS_HIST_DEPTH];
+  return 1;
+}
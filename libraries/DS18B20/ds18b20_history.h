@@ -0,0 +1,142 @@
+/**
+ * @file ds18b20_history.h
+ * @brief per-sensor history of temperature readings for the DS18B20 library
+ *
+ * @author Uwe Zimmermann
+ *
+ * The library work is licensed under a MIT license.\n
+ * See https://github.com/uwezi/AVR-Dx
+ *
+ * Every sensor keeps the last DS_HIST_SAMPLES readings with their time
+ * stamps and three tiers of aggregates (minimum, maximum, mean) over one
+ * second, one minute and one hour with DS_HIST_DEPTH entries each. The
+ * aggregates are built incrementally: a reading updates the running
+ * accumulator of the seconds tier, and only when the second changes the
+ * finished aggregate is stored and handed on to the minutes tier, and so on.
+ * Each call of DS18B20_historyAdd() does a constant amount of work.
+ *
+ * With the defaults one sensor needs 32 + 3 * 96 + 3 * 16 + 8 = 376 bytes
+ * of RAM for 8 readings, 12 seconds, 12 minutes and 12 hours of history.
+ *
+ * The values are stored as given, e.g. raw 1/16 °C or 1/100 °C from
+ * DS18B20_centi(). DS18B20_TEMP_INVALID is ignored.
+ *
+ * ChangeLog:
+ * --------
+ * * 2026-10-18 created.
+ */
+
+#ifndef ds18b20_history_h
+#define ds18b20_history_h
+
+#include <ds18b20.h>
+
+/**
+ * @brief dimensions of the history
+ */
+#ifndef DS_HIST_SENSORS
+#define DS_HIST_SENSORS 4   //!< number of sensors with history
+#endif
+#ifndef DS_HIST_SAMPLES
+#define DS_HIST_SAMPLES 8   //!< readings per sensor
+#endif
+#ifndef DS_HIST_DEPTH
+#define DS_HIST_DEPTH 12    //!< aggregates per sensor and tier
+#endif
+
+/**
+ * @brief tiers of aggregates
+ */
+#define DS_HIST_SECONDS 0
+#define DS_HIST_MINUTES 1
+#define DS_HIST_HOURS   2
+#define DS_HIST_TIERS   3
+
+/**
+ * @brief one reading, time is the lower 16 bits of the ms time stamp
+ */
+typedef struct
+{
+  uint16_t time;
+  int16_t  value;
+} DS_sample_t;
+
+/**
+ * @brief one aggregate, time is the lower 16 bits of the number of the
+ *        second, minute or hour (time stamp / 1000, / 60000, / 3600000)
+ */
+typedef struct
+{
+  uint16_t time;
+  int16_t  min;
+  int16_t  max;
+  int16_t  mean;
+} DS_aggregate_t;
+
+/**
+ * @brief running aggregate of the current second, minute or hour
+ * @note internal use
+ */
+typedef struct
+{
+  uint32_t period;  //!< number of the second, minute or hour
+  int32_t  sum;
+  uint32_t count;   //!< number of readings, 0: empty
+  int16_t  min;
+  int16_t  max;
+} DS_accu_t;
+
+/**
+ * @brief history of one sensor
+ */
+typedef struct
+{
+  DS_sample_t    samples[DS_HIST_SAMPLES];
+  DS_aggregate_t tiers[DS_HIST_TIERS][DS_HIST_DEPTH];
+  DS_accu_t      accu[DS_HIST_TIERS];
+  uint8_t        sampleHead;                 //!< next entry to be written
+  uint8_t        sampleCount;
+  uint8_t        tierHead[DS_HIST_TIERS];
+  uint8_t        tierCount[DS_HIST_TIERS];
+} DS_history_t;
+
+extern DS_history_t DS_history[DS_HIST_SENSORS];
+
+/**
+ * @name DS18B20_historyInit()
+ * @return none
+ * @brief clears the history of all sensors
+ */
+void DS18B20_historyInit(void);
+
+/**
+ * @name DS18B20_historyAdd()
+ * @param sensor - number of the sensor 0..DS_HIST_SENSORS-1
+ * @param now - time stamp of the reading in ms, must not go backwards
+ * @param value - the reading
+ * @return none
+ * @brief stores a reading and updates the aggregates, O(1)
+ */
+void DS18B20_historyAdd(uint8_t sensor, uint32_t now, int16_t value);
+
+/**
+ * @name DS18B20_historySample()
+ * @param sensor - number of the sensor
+ * @param age - 0 for the latest reading, 1 for the one before, ...
+ * @param sample - receives the reading
+ * @return uint8_t - 1 if the reading exists
+ */
+uint8_t DS18B20_historySample(uint8_t sensor, uint8_t age, DS_sample_t *sample);
+
+/**
+ * @name DS18B20_historyGet()
+ * @param sensor - number of the sensor
+ * @param tier - DS_HIST_SECONDS, DS_HIST_MINUTES or DS_HIST_HOURS
+ * @param age - 0 for the latest complete aggregate, 1 for the one before, ...
+ * @param aggregate - receives minimum, maximum and mean
+ * @return uint8_t - 1 if the aggregate exists
+ * @note the current (incomplete) second, minute or hour is not included
+ */
+uint8_t DS18B20_historyGet(uint8_t sensor, uint8_t tier, uint8_t age, DS_aggregate_t *aggregate);
+
+#endif
@@ -0,0 +1,199 @@
+/**
+ * @file ds18b20_hotplug.c
+ * @brief background detection of added and removed 1-wire devices
+ *
+ * @author Uwe Zimmermann
+ *
+ * The library work is licensed under a MIT license.\n
+ * See https://github.com/uwezi/AVR-Dx
+ *
+ * See ds18b20_hotplug.h
+ *
+ * ChangeLog:
+ * --------
+ * * 2026-10-18 created.
+ */
+
+#include <ds18b20_hotplug.h>
+
+/**
+ * @brief results of a single pass
+ * @note internal use
+ */
+enum
+{
+  DS_PASS_FOUND = 0, // reached the known target device
+  DS_PASS_NEW,       // left the known branches, found a new device
+  DS_PASS_GONE,      // the target device is missing
+  DS_PASS_EMPTY,     // no device answered
+  DS_PASS_ERROR      // inconsistent answer from the bus
+};
+
+/**
+ * @brief globals
+ */
+DS_hotplug_t DS_hotplugCallback;
+uint16_t     DS_hotplugIndex;   // next known device to visit
+uint64_t     DS_hotplugRejected; // new device which did not fit into the table
+uint8_t      DS_hotplugFull;    // DS_hotplugRejected is valid
+
+/**
+ * @name DS18B20_hotplugPass()
+ * @param target - ROM code of the known device to visit
+ * @param address - receives the ROM code found by the pass
+ * @return uint8_t - DS_PASS_...
+ * @brief one search pass towards target which branches off into every
+ *        branch without known devices
+ * @note internal use
+ */
+static uint8_t DS18B20_hotplugPass(uint64_t target, uint64_t *address)
+{
+  uint64_t addr = 0;
+  uint64_t other;
+  uint8_t  bit, chk, want;
+  uint8_t  known = (DS_devcount > 0);   // still on the way to target
+
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    if (DS18B20_reset() != 0)
+    {
+      return DS_PASS_EMPTY;
+    }
+    OW_write(DS18B20_CMD_SEARCHROM);
+    for (uint8_t count=0; count<64; count++)
+    {
+      bit = OW_readBit();
+      chk = OW_readBit();
+      if (bit && chk)
+      {                                   /* devices vanished */
+        return (count == 0) ? DS_PASS_EMPTY : DS_PASS_ERROR;
+      }
+      want = (target >> count) & 0b00000001;
+      if (!bit && !chk)
+      {                                   /* collision */
+        if (known)
+        {
+          other = addr | ((uint64_t)(want ^ 1) << count);
+          if ((DS18B20_countPrefix(other, count+1) == 0)
+              && !(DS_hotplugFull
+                   && (((other ^ DS_hotplugRejected) << (63 - count)) == 0)))
+          {                               /* unknown branch, new device */
+            want ^= 1;
+            known = 0;
+          }
+          bit = want;
+        }
+        else
+        {
+          bit = 0;
+        }
+      }
+      else if (known && (bit != want))
+      {                                   /* only the other branch exists */
+        return DS_PASS_GONE;
+      }
+      OW_writeBit(bit);
+      addr |= (uint64_t)bit << count;
+    }
+  }
+  *address = addr;
+  return known ? DS_PASS_FOUND : DS_PASS_NEW;
+}
+
+/**
+ * @name DS18B20_hotplugReport()
+ * @param address - ROM code of the device
+ * @param event - DS18B20_EVENT_ADDED or DS18B20_EVENT_REMOVED
+ * @return uint8_t - event
+ * @note internal use
+ */
+static uint8_t DS18B20_hotplugReport(uint64_t address, uint8_t event)
+{
+  if (DS_hotplugCallback)
+  {
+    DS_hotplugCallback(address, event);
+  }
+  return event;
+}
+
+/**
+ * @name DS18B20_hotplugInit()
+ * @param callback - called for every added or removed device, may be NULL
+ * @return none
+ * @brief starts the background enumeration with the devices already in
+ *        DS_addresses[], e.g. after DS18B20_scanBus() or DS18B20_startup()
+ */
+void DS18B20_hotplugInit(DS_hotplug_t callback)
+{
+  DS_hotplugCallback = callback;
+  DS_hotplugIndex = 0;
+  DS_hotplugFull = 0;
+}
+
+/**
+ * @name DS18B20_hotplugStep()
+ * @return uint8_t - DS18B20_EVENT_NONE, DS18B20_EVENT_ADDED or
+ *         DS18B20_EVENT_REMOVED
+ * @brief one search pass of the background enumeration, call it from the
+ *        main loop whenever the bus is idle
+ */
+uint8_t DS18B20_hotplugStep(void)
+{
+  uint64_t target, addr;
+  uint8_t  result;
+
+  if (DS_hotplugIndex >= DS_devcount)
+  {
+    DS_hotplugIndex = 0;
+  }
+  target = DS_devcount ? DS_addresses[DS_hotplugIndex] : 0;
+  result = DS18B20_hotplugPass(target, &addr);
+
+  for (uint8_t retry=0; ((result == DS_PASS_GONE) || (result == DS_PASS_EMPTY))
+                        && DS_devcount && (retry < DS_RETRIES); retry++)
+  {                                       /* confirm before removing */
+    DS_stats.retries++;
+    DS18B20_backoff(retry);
+    result = DS18B20_hotplugPass(target, &addr);
+  }
+
+  switch (result)
+  {
+    case DS_PASS_FOUND:
+      DS_hotplugIndex++;
+      break;
+
+    case DS_PASS_NEW:
+      if (!DS18B20_checkROM(addr))
+      {
+        DS_stats.crcErrors++;
+      }
+      else if (DS18B20_insert(addr) >= 0)
+      {
+        return DS18B20_hotplugReport(addr, DS18B20_EVENT_ADDED);
+      }
+      else
+      {                                   /* table full, stop following it */
+        DS_hotplugRejected = addr;
+        DS_hotplugFull = 1;
+      }
+      DS_hotplugIndex++;                  /* target was not visited */
+      break;
+
+    case DS_PASS_GONE:
+    case DS_PASS_EMPTY:
+      if (DS_devcount)
+      {                                   /* next device moves into the index */
+        DS18B20_remove(DS_hotplugIndex);
+        DS_hotplugFull = 0;               /* room for the rejected device */
+        return DS18B20_hotplugReport(target, DS18B20_EVENT_REMOVED);
+      }
+      break;
+
+    default:
+      DS_stats.crcErrors++;
+      DS_hotplugIndex++;
+      break;
+  }
+  return DS18B20_EVENT_NONE;
+}
@@ -0,0 +1,68 @@
+/**
+ * @file ds18b20_hotplug.h
+ * @brief background detection of added and removed 1-wire devices
+ *
+ * @author Uwe Zimmermann
+ *
+ * The library work is licensed under a MIT license.\n
+ * See https://github.com/uwezi/AVR-Dx
+ *
+ * DS18B20_hotplugStep() runs one ROM search pass (~13 ms with interrupts
+ * disabled) per call and keeps DS_addresses[] in sync with the bus:
+ *
+ * - the pass follows the branches towards one known device, the known
+ *   devices are visited round-robin. If the bus does not offer a bit of this
+ *   ROM code the device has been removed.
+ * - at every collision on the way the other branch is checked against the
+ *   table. A branch without any known device holds a new device, the pass
+ *   turns into this branch and returns the new ROM code.
+ *
+ * Every branch point which leads to a known device is checked once per
+ * round, and a change costs one pass (plus DS_RETRIES confirmation passes
+ * for a removal) - independent of the number of devices on the bus.
+ *
+ * ChangeLog:
+ * --------
+ * * 2026-10-18 created.
+ */
+
+#ifndef ds18b20_hotplug_h
+#define ds18b20_hotplug_h
+
+#include <ds18b20.h>
+
+/**
+ * @brief events reported by DS18B20_hotplugStep()
+ */
+#define DS18B20_EVENT_NONE    0 //!< nothing changed
+#define DS18B20_EVENT_ADDED   1 //!< a new device was inserted into DS_addresses[]
+#define DS18B20_EVENT_REMOVED 2 //!< a device was removed from DS_addresses[]
+
+/**
+ * @brief event callback, called after DS_addresses[] has been updated
+ */
+typedef void (*DS_hotplug_t)(uint64_t address, uint8_t event);
+
+/**
+ * @name DS18B20_hotplugInit()
+ * @param callback - called for every added or removed device, may be NULL
+ * @return none
+ * @brief starts the background enumeration with the devices already in
+ *        DS_addresses[], e.g. after DS18B20_scanBus() or DS18B20_startup()
+ */
+void DS18B20_hotplugInit(DS_hotplug_t callback);
+
+/**
+ * @name DS18B20_hotplugStep()
+ * @return uint8_t - DS18B20_EVENT_NONE, DS18B20_EVENT_ADDED or
+ *         DS18B20_EVENT_REMOVED
+ * @brief one search pass of the background enumeration, call it from the
+ *        main loop whenever the bus is idle
+ * @note DS_addresses[] is changed, indices into it are not stable. Call
+ *       DS18B20_cacheStore() from the callback to keep the stored list.
+ *       A new device which does not fit into the full table is counted
+ *       once in DS_dropped and skipped until a known device is removed.
+ */
+uint8_t DS18B20_hotplugStep(void);
+
+#endif
@@ -0,0 +1,383 @@
+/**
+ * @file ds18b20_multi.c
+ * @brief parallel 1-wire buses for the DS18B20 library
+ *
+ * @author Uwe Zimmermann
+ *
+ * The library work is licensed under a MIT license.\n
+ * See https://github.com/uwezi/AVR-Dx
+ *
+ * See ds18b20_multi.h
+ *
+ * ChangeLog:
+ * --------
+ * * 2026-10-18 created.
+ * * 2026-10-18 parasite powered buses
+ */
+
+#include <ds18b20_multi.h>
+
+/**
+ * @brief globals
+ */
+volatile PORT_t *DS_MULTI_PORT;
+uint8_t  DS_multiMask   = 0;
+uint8_t  DS_multiActive = 0;
+uint8_t  DS_multiParasite = 0;
+uint8_t  DS_multiPullup = 0;     // buses with active strong pull-up
+uint64_t DS_multiAddresses[8][DS_MULTI_MAX_DEVICES];
+uint8_t  DS_multiDevcount[8];
+
+/**
+ * @name DS18B20_multiInit()
+ * @param ds_port - PORT-module for the 1-wire buses
+ * @param mask - pins of the PORT with a 1-wire bus
+ * @return none
+ * @brief initialize the pins for parallel 1-wire communication
+ */
+void DS18B20_multiInit(volatile PORT_t *ds_port, uint8_t mask)
+{
+  DS_MULTI_PORT = ds_port;
+  DS_multiMask  = mask;
+  DS_multiActive = mask;
+  DS_MULTI_PORT->DIRCLR = mask;
+  DS_MULTI_PORT->OUTCLR = mask;
+  DS_MULTI_PORT->PINCONFIG = PORT_PULLUPEN_bm | PORT_ISC_INTDISABLE_gc;
+  DS_MULTI_PORT->PINCTRLUPD = mask;
+}
+
+/**
+ * @name DS18B20_multiReset()
+ * @return uint8_t - mask of the buses with a presence pulse
+ * @brief resets all buses at the same time, the buses with devices
+ *        become the active buses
+ */
+uint8_t DS18B20_multiReset(void)
+{
+  uint8_t result;
+
+  DS_MULTI_PORT->DIRSET = DS_multiMask;
+  _delay_us(480);
+  DS_MULTI_PORT->DIRCLR = DS_multiMask;
+  _delay_us(60);
+  result = ~DS_MULTI_PORT->IN & DS_multiMask;
+  _delay_us(420);
+  DS_multiActive = result;
+  return result;
+}
+
+/**
+ * @name DS18B20_multiSlot()
+ * @param ones - mask of the buses which write a 1 or read
+ * @return uint8_t - state of the active buses in the middle of the slot
+ * @brief one time slot on all active buses, writes a 0 on the active buses
+ *        not contained in ones
+ * @note internal use
+ */
+uint8_t DS18B20_multiSlot(uint8_t ones)
+{
+  uint8_t result;
+
+  // only the start of the slot up to the sampling point is time critical
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    DS_MULTI_PORT->DIRSET = DS_multiActive;
+    _delay_us(1);
+    DS_MULTI_PORT->DIRCLR = ones;
+    _delay_us(10);
+    result = DS_MULTI_PORT->IN;
+  }
+  _delay_us(50);
+  DS_MULTI_PORT->DIRCLR = DS_multiActive;
+  _delay_us(2);
+  return result & DS_multiActive;
+}
+
+/**
+ * @name DS18B20_multiWrite()
+ * @param byte - data to be written to all active buses
+ * @return none
+ * @brief writes the same byte on all active buses
+ */
+void DS18B20_multiWrite(uint8_t byte)
+{  // LSB first
+  for (uint8_t i=8; i>0; i--)
+  {
+    DS18B20_multiSlot((byte & 0b00000001) ? DS_multiActive : 0);
+    byte >>= 1;
+  }
+}
+
+/**
+ * @name DS18B20_multiWriteBytes()
+ * @param bytes - bytes[n] is written to the bus on pin n
+ * @return none
+ * @brief writes a different byte on each active bus
+ */
+void DS18B20_multiWriteBytes(const uint8_t *bytes)
+{  // LSB first
+  uint8_t b[8];
+  memcpy(b, bytes, 8);
+  for (uint8_t i=8; i>0; i--)
+  {
+    uint8_t ones = 0;
+    for (uint8_t n=0; n<8; n++)
+    {
+      ones |= (b[n] & 0b00000001) << n;
+      b[n] >>= 1;
+    }
+    DS18B20_multiSlot(ones);
+  }
+}
+
+/**
+ * @name DS18B20_multiReadBytes()
+ * @param bytes - bytes[n] receives the byte from the bus on pin n
+ * @return none
+ * @brief reads one byte from every active bus
+ */
+void DS18B20_multiReadBytes(uint8_t *bytes)
+{  // LSB first
+  memset(bytes, 0, 8);
+  for (uint8_t i=0; i<8; i++)
+  {
+    uint8_t in = DS18B20_multiSlot(DS_multiActive);
+    for (uint8_t n=0; n<8; n++)
+    {
+      bytes[n] |= ((in >> n) & 0b00000001) << i;
+    }
+  }
+}
+
+/**
+ * @name DS18B20_multiScan()
+ * @return uint8_t - mask of the buses with devices
+ * @return DS_multiAddresses[][], DS_multiDevcount[] - found devices per bus
+ * @brief runs the ROM search of DS18B20_scanBus() on all buses in parallel,
+ *        a bus leaves the search as soon as all its devices are found
+ * @note the decision markers 'path', 'next' and 'pos' are kept per bus,
+ *       see DS18B20_scanBus() for the algorithm
+ */
+uint8_t DS18B20_multiScan(void)
+{
+  uint64_t addr[8], path[8], next[8], pos[8];
+  uint8_t  searching, found, bits, chks, ones, n;
+
+  found = DS18B20_multiReset();
+  searching = found;
+  for (n=0; n<8; n++)
+  {
+    path[n] = 0;
+    DS_multiDevcount[n] = 0;
+  }
+
+  while (searching)
+  {                                         /* each ROM search pass */
+    DS18B20_multiReset();
+    DS_multiActive &= searching;            /* finished buses stay idle */
+    DS18B20_multiWrite(DS18B20_CMD_SEARCHROM);
+    for (n=0; n<8; n++)
+    {
+      addr[n] = 0;
+      next[n] = 0;
+      pos[n] = 1;
+    }
+    for (uint8_t count=0; count<64; count++)
+    {                                       /* each bit of the ROM value */
+      bits = DS18B20_multiSlot(DS_multiActive);
+      chks = DS18B20_multiSlot(DS_multiActive);
+      ones = bits;
+      for (n=0; n<8; n++)
+      {
+        if (!(DS_multiActive & (1 << n)))
+        {
+          continue;
+        }
+        if (!(bits & (1 << n)) && !(chks & (1 << n)))
+        {                                   /* collision, both are zero */
+          if (pos[n] & path[n])
+          {
+            ones |= 1 << n;                 /* if we've been here before */
+          }
+          else
+          {
+            next[n] = (path[n] & (pos[n]-1)) | pos[n];
+          }
+          pos[n] <<= 1;
+        }
+        addr[n] |= (uint64_t)((ones >> n) & 0b00000001) << count;
+      }
+      DS18B20_multiSlot(ones);
+    }
+
+    for (n=0; n<8; n++)
+    {
+      if (!(DS_multiActive & (1 << n)))
+      {
+        continue;
+      }
+      if (DS_multiDevcount[n] < DS_MULTI_MAX_DEVICES)
+      {
+        DS_multiAddresses[n][DS_multiDevcount[n]++] = addr[n];
+      }
+      path[n] = next[n];
+      if (!path[n])
+      {
+        searching &= ~(1 << n);             /* all devices of this bus found */
+      }
+    }
+    searching &= DS_multiActive;            /* buses which lost their devices */
+    _delay_ms(1);
+  }
+  return found;
+}
+
+/**
+ * @name DS18B20_multiSelect()
+ * @param index - index into DS_multiAddresses[n][] of every bus
+ * @return uint8_t - mask of the selected buses
+ * @brief resets all buses and selects device number index on every bus
+ *        which has at least index+1 devices
+ */
+uint8_t DS18B20_multiSelect(uint8_t index)
+{
+  uint8_t bytes[8];
+  uint8_t select = 0;
+
+  for (uint8_t n=0; n<8; n++)
+  {
+    if (DS_multiDevcount[n] > index)
+    {
+      select |= 1 << n;
+    }
+  }
+  DS18B20_multiReset();
+  DS_multiActive &= select;
+  DS18B20_multiWrite(DS18B20_CMD_MATCHROM);
+  for (uint8_t i=0; i<64; i+=8)
+  {
+    for (uint8_t n=0; n<8; n++)
+    {
+      bytes[n] = (DS_multiActive & (1 << n)) ? (uint8_t)(DS_multiAddresses[n][index] >> i) : 0;
+    }
+    DS18B20_multiWriteBytes(bytes);
+  }
+  return DS_multiActive;
+}
+
+/**
+ * @name DS18B20_multiPowerSupply()
+ * @return uint8_t - mask of the buses with parasite powered devices
+ * @brief asks the devices of all buses for their power supply, sets
+ *        DS_multiParasite
+ */
+uint8_t DS18B20_multiPowerSupply(void)
+{
+  DS18B20_multiReset();
+  DS18B20_multiWrite(DS18B20_CMD_SKIPROM);
+  DS18B20_multiWrite(DS18B20_CMD_RPWRSUPPLY);
+  // parasite powered devices pull the line low
+  DS_multiParasite = ~DS18B20_multiSlot(DS_multiActive) & DS_multiActive;
+  return DS_multiParasite;
+}
+
+/**
+ * @name DS18B20_multiConvert()
+ * @return uint8_t - mask of the buses with devices
+ * @brief starts a temperature conversion on all devices of all buses, the
+ *        parasite powered buses get the strong pull-up
+ */
+uint8_t DS18B20_multiConvert(void)
+{
+  uint8_t result = DS18B20_multiReset();
+  DS18B20_multiWrite(DS18B20_CMD_SKIPROM);
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {                                         // strong pull-up within 10 µs
+    DS18B20_multiWrite(DS18B20_CMD_CONVERTTEMP);
+    DS_multiPullup = DS_multiParasite & result;
+    DS_MULTI_PORT->OUTSET = DS_multiPullup;
+    DS_MULTI_PORT->DIRSET = DS_multiPullup;
+  }
+  DS_multiActive &= ~DS_multiPullup;        // no time slots on these pins
+  return result;
+}
+
+/**
+ * @name DS18B20_multiBusy()
+ * @return uint8_t - mask of the buses still converting
+ * @brief reads one bit from all active buses after a DS18B20_multiConvert()
+ */
+uint8_t DS18B20_multiBusy(void)
+{
+  return ~DS18B20_multiSlot(DS_multiActive) & DS_multiActive;
+}
+
+/**
+ * @name DS18B20_multiWaitConversion()
+ * @return none
+ * @brief waits for the end of a DS18B20_multiConvert(): externally powered
+ *        buses are polled and leave the wait as soon as their devices are
+ *        ready, parasite powered buses keep the strong pull-up for the
+ *        conversion time of DS_resolution
+ */
+void DS18B20_multiWaitConversion(void)
+{
+  uint16_t t = DS18B20_conversionTime(DS_resolution);
+  uint8_t  busy = DS_multiActive;
+
+  while (t--)
+  {
+    DS_multiActive = busy;
+    if (busy)
+    {
+      busy = DS18B20_multiBusy();
+    }
+    if (!busy && !DS_multiPullup)
+    {
+      break;
+    }
+    _delay_ms(1);
+  }
+  DS_MULTI_PORT->DIRCLR = DS_multiPullup;
+  DS_MULTI_PORT->OUTCLR = DS_multiPullup;
+  DS_multiPullup = 0;
+}
+
+/**
+ * @name DS18B20_multiReadTemperatures()
+ * @param temps - temps[n][i] receives the raw temperature of device i on
+ *        the bus on pin n
+ * @return none
+ * @brief reads the temperatures of all devices found by DS18B20_multiScan(),
+ *        device i of all buses is read in the same pass
+ */
+void DS18B20_multiReadTemperatures(int16_t temps[8][DS_MULTI_MAX_DEVICES])
+{
+  uint8_t lo[8], hi[8];
+  uint8_t maxcount = 0;
+
+  for (uint8_t n=0; n<8; n++)
+  {
+    if (DS_multiDevcount[n] > maxcount)
+    {
+      maxcount = DS_multiDevcount[n];
+    }
+  }
+  for (uint8_t i=0; i<maxcount; i++)
+  {
+    if (DS18B20_multiSelect(i))
+    {
+      DS18B20_multiWrite(DS18B20_CMD_RSCRATCHPAD);
+      //Read Scratchpad (only 2 first bytes)
+      DS18B20_multiReadBytes(lo);
+      DS18B20_multiReadBytes(hi);
+      for (uint8_t n=0; n<8; n++)
+      {
+        if (DS_multiActive & (1 << n))
+        {
+          temps[n][i] = lo[n] | (hi[n] << 8);
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,171 @@
+/**
+ * @file ds18b20_multi.h
+ * @brief parallel 1-wire buses for the DS18B20 library
+ *
+ * @author Uwe Zimmermann
+ *
+ * The library work is licensed under a MIT license.\n
+ * See https://github.com/uwezi/AVR-Dx
+ *
+ * Up to 8 separate 1-wire buses on the pins of one PORT are driven in
+ * lock-step: every time slot is a single write to DIRSET/DIRCLR with a pin
+ * mask and a single read of IN for all buses. Reset, search, conversion and
+ * scratchpad reads run on all buses at the same time, an array of 8 buses
+ * takes about as long as the bus with the most devices.
+ *
+ * Bit n of every mask in this module corresponds to pin n of the PORT.
+ *
+ * ChangeLog:
+ * --------
+ * * 2026-10-18 created.
+ * * 2026-10-18 DS_MULTI_MAX_DEVICES can be set separately
+ * * 2026-10-18 parasite powered buses
+ */
+
+#ifndef ds18b20_multi_h
+#define ds18b20_multi_h
+
+#include <ds18b20.h>
+#include <string.h>
+
+/**
+ * list of found sensors on each bus after a DS18B20_multiScan()
+ * @note 64 bytes of RAM per entry (8 buses), keep it small; the counts are
+ *       uint8_t, set DS_MULTI_MAX_DEVICES separately for builds with more
+ *       than 255 DS_MAX_DEVICES
+ */
+#ifndef DS_MULTI_MAX_DEVICES
+#define DS_MULTI_MAX_DEVICES DS_MAX_DEVICES
+#endif
+#if DS_MULTI_MAX_DEVICES > 255
+#error "DS_MULTI_MAX_DEVICES must not exceed 255"
+#endif
+extern uint64_t DS_multiAddresses[8][DS_MULTI_MAX_DEVICES];
+extern uint8_t  DS_multiDevcount[8];
+
+/**
+ * mask of the buses taking part in the next time slots, set by
+ * DS18B20_multiReset() and DS18B20_multiSelect()
+ */
+extern uint8_t DS_multiActive;
+
+/**
+ * mask of the buses with parasite powered devices, set by
+ * DS18B20_multiPowerSupply(). During a conversion these pins are driven
+ * high as strong pull-up and are not polled.
+ */
+extern uint8_t DS_multiParasite;
+
+/**
+ * @name DS18B20_multiInit()
+ * @param ds_port - PORT-module for the 1-wire buses
+ * @param mask - pins of the PORT with a 1-wire bus
+ * @return none
+ * @brief initialize the pins for parallel 1-wire communication
+ */
+void DS18B20_multiInit(volatile PORT_t *ds_port, uint8_t mask);
+
+/**
+ * @name DS18B20_multiReset()
+ * @return uint8_t - mask of the buses with a presence pulse
+ * @brief resets all buses at the same time, the buses with devices
+ *        become the active buses
+ */
+uint8_t DS18B20_multiReset(void);
+
+/**
+ * @name DS18B20_multiSlot()
+ * @param ones - mask of the buses which write a 1 or read
+ * @return uint8_t - state of the active buses in the middle of the slot
+ * @brief one time slot on all active buses, writes a 0 on the active buses
+ *        not contained in ones
+ * @note internal use
+ */
+uint8_t DS18B20_multiSlot(uint8_t ones);
+
+/**
+ * @name DS18B20_multiWrite()
+ * @param byte - data to be written to all active buses
+ * @return none
+ * @brief writes the same byte on all active buses
+ */
+void DS18B20_multiWrite(uint8_t byte);
+
+/**
+ * @name DS18B20_multiWriteBytes()
+ * @param bytes - bytes[n] is written to the bus on pin n
+ * @return none
+ * @brief writes a different byte on each active bus
+ */
+void DS18B20_multiWriteBytes(const uint8_t *bytes);
+
+/**
+ * @name DS18B20_multiReadBytes()
+ * @param bytes - bytes[n] receives the byte from the bus on pin n
+ * @return none
+ * @brief reads one byte from every active bus
+ */
+void DS18B20_multiReadBytes(uint8_t *bytes);
+
+/**
+ * @name DS18B20_multiScan()
+ * @return uint8_t - mask of the buses with devices
+ * @return DS_multiAddresses[][], DS_multiDevcount[] - found devices per bus
+ * @brief runs the ROM search of DS18B20_scanBus() on all buses in parallel,
+ *        a bus leaves the search as soon as all its devices are found
+ */
+uint8_t DS18B20_multiScan(void);
+
+/**
+ * @name DS18B20_multiSelect()
+ * @param index - index into DS_multiAddresses[n][] of every bus
+ * @return uint8_t - mask of the selected buses
+ * @brief resets all buses and selects device number index on every bus
+ *        which has at least index+1 devices
+ */
+uint8_t DS18B20_multiSelect(uint8_t index);
+
+/**
+ * @name DS18B20_multiPowerSupply()
+ * @return uint8_t - mask of the buses with parasite powered devices
+ * @brief asks the devices of all buses for their power supply, sets
+ *        DS_multiParasite
+ */
+uint8_t DS18B20_multiPowerSupply(void);
+
+/**
+ * @name DS18B20_multiConvert()
+ * @return uint8_t - mask of the buses with devices
+ * @brief starts a temperature conversion on all devices of all buses, the
+ *        parasite powered buses get the strong pull-up
+ */
+uint8_t DS18B20_multiConvert(void);
+
+/**
+ * @name DS18B20_multiBusy()
+ * @return uint8_t - mask of the buses still converting
+ * @brief reads one bit from all active buses after a DS18B20_multiConvert()
+ */
+uint8_t DS18B20_multiBusy(void);
+
+/**
+ * @name DS18B20_multiWaitConversion()
+ * @return none
+ * @brief waits for the end of a DS18B20_multiConvert(): externally powered
+ *        buses are polled and leave the wait as soon as their devices are
+ *        ready, parasite powered buses keep the strong pull-up for the
+ *        conversion time of DS_resolution
+ */
+void DS18B20_multiWaitConversion(void);
+
+/**
+ * @name DS18B20_multiReadTemperatures()
+ * @param temps - temps[n][i] receives the raw temperature of device i on
+ *        the bus on pin n
+ * @return none
+ * @brief reads the temperatures of all devices found by DS18B20_multiScan(),
+ *        device i of all buses is read in the same pass
+ */
+void DS18B20_multiReadTemperatures(int16_t temps[8][DS_MULTI_MAX_DEVICES]);
+
+#endif
@@ -0,0 +1,177 @@
+/**
+ * @file ds18b20_sched.c
+ * @brief non-blocking measurement scheduler for devices with different
+ *        resolutions on one 1-wire bus
+ *
+ * @author Uwe Zimmermann
+ *
+ * The library work is licensed under a MIT license.\n
+ * See https://github.com/uwezi/AVR-Dx
+ *
+ * See ds18b20_sched.h
+ *
+ * ChangeLog:
+ * --------
+ * * 2026-10-18 created.
+ */
+
+#include <ds18b20_sched.h>
+
+/**
+ * @brief globals
+ */
+DS_schedGroup_t DS_schedGroups[4];
+uint8_t DS_schedGroup[DS_MAX_DEVICES];
+int16_t DS_schedTemps[DS_MAX_DEVICES];
+
+/**
+ * @brief configuration register of a group and vice versa
+ */
+#define DS_SCHED_CFG(group)   ((group) << 5)
+#define DS_SCHED_GROUP(cfg)   (((cfg) & DS18B20_CFG_gm) >> 5)
+
+/**
+ * @name DS18B20_schedInit()
+ * @return uint16_t - number of devices which take part
+ * @brief reads the resolution of every device in DS_addresses[] and sets the
+ *        period of every group to its conversion time
+ */
+uint16_t DS18B20_schedInit(void)
+{
+  uint8_t scratchpad[9];
+  uint8_t g;
+
+  for (g=0; g<4; g++)
+  {
+    DS_schedGroups[g].period = DS18B20_conversionTime(DS_SCHED_CFG(g));
+    DS_schedGroups[g].count = 0;
+    DS_schedGroups[g].state = DS_SCHED_DUE;
+  }
+  if (DS_parasite)
+  {
+    return 0;
+  }
+  for (uint16_t i=0; i<DS_devcount; i++)
+  {
+    // unreadable devices go to the slowest group, their conversion time is safe
+    g = (DS18B20_readScratchpad(DS_addresses[i], scratchpad) == DS18B20_OK)
+        ? DS_SCHED_GROUP(scratchpad[4]) : 3;
+    DS_schedGroup[i] = g;
+    DS_schedGroups[g].count++;
+    DS_schedTemps[i] = DS18B20_TEMP_INVALID;
+  }
+  return DS_devcount;
+}
+
+/**
+ * @name DS18B20_schedPeriod()
+ * @param config DS18B20_CFG_9BIT .. DS18B20_CFG_12BIT
+ * @param period ms between two measurements, 0 to stop the group, values
+ *        below the conversion time are rounded up to it
+ * @return none
+ */
+void DS18B20_schedPeriod(uint8_t config, uint16_t period)
+{
+  uint16_t t = DS18B20_conversionTime(config);
+
+  if (period && (period < t))
+  {
+    period = t;
+  }
+  DS_schedGroups[DS_SCHED_GROUP(config)].period = period;
+}
+
+/**
+ * @name DS18B20_schedConvert()
+ * @param g group number 0..3
+ * @return none
+ * @brief starts the conversion of all devices of a group
+ * @note internal use
+ */
+static void DS18B20_schedConvert(uint8_t g)
+{
+  if (DS_schedGroups[g].count == DS_devcount)
+  {                                   // all devices, one broadcast
+    DS18B20_startConversion();
+    return;
+  }
+  for (uint16_t i=0; i<DS_devcount; i++)
+  {
+    if (DS_schedGroup[i] == g)
+    {
+      DS18B20_convertDevice(DS_addresses[i]);
+    }
+  }
+}
+
+/**
+ * @name DS18B20_schedRead()
+ * @param g group number 0..3
+ * @return none
+ * @brief reads the temperatures of all devices of a group
+ * @note internal use
+ */
+static void DS18B20_schedRead(uint8_t g)
+{
+  uint8_t scratchpad[9];
+
+  for (uint16_t i=0; i<DS_devcount; i++)
+  {
+    if (DS_schedGroup[i] == g)
+    {
+      if (DS18B20_readScratchpad(DS_addresses[i], scratchpad) == DS18B20_OK)
+      {
+        DS_schedTemps[i] = scratchpad[0] | (scratchpad[1] << 8);
+      }
+      else
+      {
+        DS_schedTemps[i] = DS18B20_TEMP_INVALID;
+      }
+    }
+  }
+}
+
+/**
+ * @name DS18B20_schedule()
+ * @param now time stamp in ms, wraps around after 65.5 s
+ * @return uint8_t - bit n set if group n has delivered new temperatures
+ * @brief starts and reads the conversions which are due
+ */
+uint8_t DS18B20_schedule(uint16_t now)
+{
+  DS_schedGroup_t *group;
+  uint8_t ready = 0;
+
+  for (uint8_t g=0; g<4; g++)
+  {
+    group = &DS_schedGroups[g];
+    if (!group->count || !group->period)
+    {
+      continue;
+    }
+    switch (group->state)
+    {
+      case DS_SCHED_CONVERTING:
+        if ((uint16_t)(now - group->start) >= DS18B20_conversionTime(DS_SCHED_CFG(g)))
+        {
+          DS18B20_schedRead(g);
+          group->state = DS_SCHED_WAITING;
+          ready |= 1 << g;
+        }
+        break;
+
+      case DS_SCHED_WAITING:
+        if ((uint16_t)(now - group->start) < group->period)
+        {
+          break;
+        }
+        // fall through
+      default:
+        DS18B20_schedConvert(g);
+        group->start = now;
+        group->state = DS_SCHED_CONVERTING;
+        break;
+    }
+  }
+  return ready;
+}
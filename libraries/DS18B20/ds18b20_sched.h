@@ -0,0 +1,88 @@
+/**
+ * @file ds18b20_sched.h
+ * @brief non-blocking measurement scheduler for devices with different
+ *        resolutions on one 1-wire bus
+ *
+ * @author Uwe Zimmermann
+ *
+ * The library work is licensed under a MIT license.\n
+ * See https://github.com/uwezi/AVR-Dx
+ *
+ * The devices in DS_addresses[] are grouped by their resolution (read from
+ * their configuration registers by DS18B20_schedInit()). Every group has its
+ * own period; the conversions of a group are started with MATCHROM device by
+ * device, the results are read when the conversion time of the group's
+ * resolution is over. A group of 9-bit devices can thus be sampled every
+ * 100 ms while the 12-bit devices on the same bus convert for 750 ms.
+ *
+ * DS18B20_schedule() never waits for a conversion, it only does the 1-wire
+ * transfers which are due and returns. Call it from the main loop with a
+ * millisecond time stamp.
+ *
+ * The devices must be externally powered, a strong pull-up for one device
+ * would cut off the others.
+ *
+ * ChangeLog:
+ * --------
+ * * 2026-10-18 created.
+ */
+
+#ifndef ds18b20_sched_h
+#define ds18b20_sched_h
+
+#include <ds18b20.h>
+
+/**
+ * @brief state of one resolution group
+ */
+typedef struct
+{
+  uint16_t period;  //!< ms from one conversion start to the next, 0: group off
+  uint16_t start;   //!< time stamp of the last conversion start
+  uint16_t count;   //!< number of devices in the group
+  uint8_t  state;   //!< DS_SCHED_DUE, DS_SCHED_CONVERTING or DS_SCHED_WAITING
+} DS_schedGroup_t;
+
+#define DS_SCHED_DUE        0
+#define DS_SCHED_CONVERTING 1
+#define DS_SCHED_WAITING    2
+
+/**
+ * @brief the groups 0..3 hold the devices with 9..12 bit resolution
+ */
+extern DS_schedGroup_t DS_schedGroups[4];
+
+/**
+ * @brief group of every device in DS_addresses[], and its last temperature
+ *        (raw 1/16 °C, DS18B20_TEMP_INVALID until the first reading)
+ */
+extern uint8_t DS_schedGroup[DS_MAX_DEVICES];
+extern int16_t DS_schedTemps[DS_MAX_DEVICES];
+
+/**
+ * @name DS18B20_schedInit()
+ * @return uint16_t - number of devices which take part
+ * @brief reads the resolution of every device in DS_addresses[] and sets the
+ *        period of every group to its conversion time
+ * @note call again after DS_addresses[] or a resolution has changed
+ */
+uint16_t DS18B20_schedInit(void);
+
+/**
+ * @name DS18B20_schedPeriod()
+ * @param config DS18B20_CFG_9BIT .. DS18B20_CFG_12BIT
+ * @param period ms between two measurements, 0 to stop the group, values
+ *        below the conversion time are rounded up to it
+ * @return none
+ */
+void DS18B20_schedPeriod(uint8_t config, uint16_t period);
+
+/**
+ * @name DS18B20_schedule()
+ * @param now time stamp in ms, wraps around after 65.5 s
+ * @return uint8_t - bit n set if group n has delivered new temperatures
+ * @brief starts and reads the conversions which are due
+ */
+uint8_t DS18B20_schedule(uint16_t now);
+
+#endif
@@ -0,0 +1,215 @@
+/**
+ * @file ds18b20_tcb.c
+ * @brief non-blocking 1-wire transfers driven by a TCB compare interrupt
+ *
+ * @author Uwe Zimmermann
+ *
+ * The library work is licensed under a MIT license.\n
+ * See https://github.com/uwezi/AVR-Dx
+ *
+ * The TCB runs in periodic interrupt mode, the counter restarts at every
+ * compare match and the ISR loads the length of the next phase into CCMP.
+ * Only the parts of a time slot which have to be exact to the microsecond
+ * (the 1 µs start pulse and the sampling of a read slot) are done with
+ * _delay_us() inside the ISR, all longer phases are timed by the TCB.
+ *
+ * ChangeLog:
+ * --------
+ * * 2026-10-18 created.
+ * * 2026-10-18 pin access through onewire.c
+ * * 2026-10-18 byte and block functions moved to ds18b20_async.c
+ */
+
+#include <ds18b20_async.h>
+
+/**
+ * @brief conversion from µs to TCB ticks, the TCB runs at F_CPU
+ */
+#define DS_TICKS(us) ((uint16_t)((F_CPU / 1000000UL) * (us)))
+
+/**
+ * @brief states of the engine
+ * @note internal use
+ */
+enum
+{
+  DS_STATE_RESET_LOW = 1,         // DS_STATE_IDLE is 0
+  DS_STATE_RESET_SAMPLE,
+  DS_STATE_RESET_END,
+  DS_STATE_SLOT,
+  DS_STATE_SLOT_RELEASE,
+  DS_STATE_DONE
+};
+
+/**
+ * @brief result of the reset or the transfer
+ * @note internal use
+ */
+uint8_t  DS_asyncResult;
+
+/**
+ * @name DS18B20_asyncStart()
+ * @param state - first state of the engine
+ * @param ticks - TCB ticks until the first interrupt
+ * @brief starts the TCB for a new transfer
+ * @note internal use
+ */
+static void DS18B20_asyncStart(uint8_t state, uint16_t ticks)
+{
+  DS_asyncState = state;
+  DS_TCB.CNT = 0;
+  DS_TCB.CCMP = ticks;
+  DS_TCB.INTFLAGS = TCB_CAPT_bm;
+  DS_TCB.CTRLA |= TCB_ENABLE_bm;
+}
+
+/**
+ * @name DS18B20_asyncNextBit()
+ * @param bit - the bit which was just transferred
+ * @brief shifts the bit into the current byte, advances in the block
+ * @note internal use, called from the ISR
+ */
+static inline void DS18B20_asyncNextBit(uint8_t bit)
+{
+  DS_asyncByte >>= 1;
+  if (DS_asyncReading)
+  {
+    DS_asyncByte |= bit << 7;
+  }
+  DS_asyncState = DS_STATE_SLOT;
+  if (++DS_asyncBit == 8)
+  {
+    DS_asyncBit = 0;
+    if (DS_asyncReading)
+    {
+      *DS_asyncBuf = DS_asyncByte;
+    }
+    DS_asyncBuf++;
+    if (--DS_asyncLen == 0)
+    {
+      DS_asyncState = DS_STATE_DONE;
+    }
+    else if (!DS_asyncReading)
+    {
+      DS_asyncByte = *DS_asyncBuf;
+    }
+  }
+}
+
+/**
+ * @brief interrupt service routine of the 1-wire engine
+ * @note the interrupts are masked while this routine runs, keep it short
+ */
+ISR(DS_TCB_INTVEC)
+{
+  uint8_t bit;
+  DS_TCB.INTFLAGS = TCB_CAPT_bm;
+
+  switch (DS_asyncState)
+  {
+    case DS_STATE_RESET_LOW:      // 480 µs are over
+      OW_release();
+      DS_TCB.CCMP = DS_TICKS(70);
+      DS_asyncState = DS_STATE_RESET_SAMPLE;
+      break;
+
+    case DS_STATE_RESET_SAMPLE:   // within the presence pulse
+      DS_asyncResult = OW_get() ? DS_ASYNC_NOPRESENCE : DS_ASYNC_OK;
+      DS_TCB.CCMP = DS_TICKS(410);
+      DS_asyncState = DS_STATE_RESET_END;
+      break;
+
+    case DS_STATE_SLOT:           // start of a new time slot
+      bit = DS_asyncReading | (DS_asyncByte & 0b00000001);
+      OW_set();
+      if (bit)
+      {
+        _delay_us(1);
+        OW_release();
+        if (DS_asyncReading)
+        {
+          _delay_us(10);
+          bit = OW_get();
+        }
+        DS_TCB.CCMP = DS_TICKS(60);
+        DS18B20_asyncNextBit(bit);
+      }
+      else
+      {                           // writing a 0, keep the line low
+        DS_TCB.CCMP = DS_TICKS(65);
+        DS_asyncState = DS_STATE_SLOT_RELEASE;
+      }
+      break;
+
+    case DS_STATE_SLOT_RELEASE:   // end of a written 0
+      OW_release();
+      DS_TCB.CCMP = DS_TICKS(5);  // recovery time
+      DS18B20_asyncNextBit(0);
+      break;
+
+    case DS_STATE_DONE:
+      DS_asyncResult = DS_ASYNC_OK;
+      // fall through
+    case DS_STATE_RESET_END:
+      DS_TCB.CTRLA &= ~TCB_ENABLE_bm;
+      DS_asyncState = DS_STATE_IDLE;
+      if (DS_asyncDone)
+      {
+        DS_asyncDone(DS_asyncResult);
+      }
+      break;
+
+    default:
+      DS_TCB.CTRLA &= ~TCB_ENABLE_bm;
+      DS_asyncState = DS_STATE_IDLE;
+      break;
+  }
+}
+
+/**
+ * @name DS18B20_asyncInit()
+ * @param ds_port - PORT-module for the 1-wire devices
+ * @param pin - PIN number for the 1-wire devices 0..7
+ * @return none
+ * @brief initialize the 1-wire pin and the timer of the asynchronous engine
+ */
+void DS18B20_asyncInit(volatile PORT_t *ds_port, uint8_t pin)
+{
+  DS18B20_init(ds_port, pin);
+  OW_release();
+  DS_asyncState = DS_STATE_IDLE;
+  DS_TCB.CTRLA = TCB_CLKSEL_DIV1_gc;
+  DS_TCB.CTRLB = TCB_CNTMODE_INT_gc;
+  DS_TCB.INTFLAGS = TCB_CAPT_bm;
+  DS_TCB.INTCTRL = TCB_CAPT_bm;
+  sei();
+}
+
+/**
+ * @name DS18B20_asyncReset()
+ * @param done - callback, receives DS_ASYNC_OK if a device answered
+ * @return uint8_t - 0 if started, 1 if the engine is busy
+ * @brief starts a bus reset with presence detection
+ */
+uint8_t DS18B20_asyncReset(DS_callback_t done)
+{
+  if (DS18B20_asyncBusy())
+  {
+    return 1;
+  }
+  DS_asyncDone = done;
+  OW_set();
+  DS18B20_asyncStart(DS_STATE_RESET_LOW, DS_TICKS(480));
+  return 0;
+}
+
+/**
+ * @name DS18B20_asyncBegin()
+ * @return none
+ * @brief starts the first time slot of a transfer
+ * @note internal use, called by ds18b20_async.c
+ */
+void DS18B20_asyncBegin(void)
+{
+  DS18B20_asyncStart(DS_STATE_SLOT, DS_TICKS(2));
+}
@@ -0,0 +1,169 @@
+/**
+ * @file ds18b20_usart.c
+ * @brief non-blocking 1-wire transfers using a USART in one-wire mode
+ *
+ * @author Uwe Zimmermann
+ *
+ * The library work is licensed under a MIT license.\n
+ * See https://github.com/uwezi/AVR-Dx
+ *
+ * The USART runs with loop-back (LBME) and open-drain output (ODME), i.e. RX
+ * sees the real state of the 1-wire line while TX is transmitting.
+ *
+ * - write 1: 0xFF at 115200 baud - only the start bit (8.7 µs) is low
+ * - write 0: 0x00 at 115200 baud - start bit + 8 data bits (78 µs) are low
+ * - read:    0xFF at 115200 baud - a device sending a 0 stretches the low
+ *            phase, the echo is no longer 0xFF
+ * - reset:   0xF0 at 9600 baud - 520 µs low, the presence pulse of the
+ *            devices changes the echo of the upper bits
+ *
+ * Every echoed character triggers the receive interrupt, which evaluates
+ * the bit and sends the next character. No timing depends on F_CPU being
+ * exact or on _delay_us().
+ *
+ * ChangeLog:
+ * --------
+ * * 2026-10-18 created.
+ * * 2026-10-18 byte and block functions moved to ds18b20_async.c
+ */
+
+#include <ds18b20_async.h>
+
+/**
+ * @brief baud rates for the time slots and the reset pulse
+ */
+#define DS_UART_SLOTBAUD  115200
+#define DS_UART_RESETBAUD 9600
+
+/**
+ * @brief states of the engine
+ * @note internal use
+ */
+enum
+{
+  DS_STATE_RESET = 1,             // DS_STATE_IDLE is 0
+  DS_STATE_SLOT
+};
+
+/**
+ * @name DS18B20_asyncSlot()
+ * @brief sends the character for the next time slot
+ * @note internal use
+ */
+static inline void DS18B20_asyncSlot(void)
+{
+  DS_UART.TXDATAL = (DS_asyncReading || (DS_asyncByte & 0b00000001)) ? 0xFF : 0x00;
+}
+
+/**
+ * @name DS18B20_asyncFinish()
+ * @param result - value handed to the callback
+ * @brief ends a transfer and calls the callback
+ * @note internal use
+ */
+static void DS18B20_asyncFinish(uint8_t result)
+{
+  DS_asyncState = DS_STATE_IDLE;
+  if (DS_asyncDone)
+  {
+    DS_asyncDone(result);
+  }
+}
+
+/**
+ * @brief interrupt service routine for the echo of every time slot
+ */
+ISR(DS_UART_INTVEC)
+{
+  uint8_t echo = DS_UART.RXDATAL;
+  uint8_t bit;
+
+  switch (DS_asyncState)
+  {
+    case DS_STATE_RESET:
+      // the character has been received, so TX is idle and the baud rate may change
+      DS_UART.BAUD = DS_UART_BAUD_CALC(DS_UART_SLOTBAUD);
+      DS18B20_asyncFinish((echo == 0xF0) ? DS_ASYNC_NOPRESENCE : DS_ASYNC_OK);
+      break;
+
+    case DS_STATE_SLOT:
+      bit = (echo == 0xFF) ? 1 : 0;
+      DS_asyncByte >>= 1;
+      if (DS_asyncReading)
+      {
+        DS_asyncByte |= bit << 7;
+      }
+      if (++DS_asyncBit == 8)
+      {
+        DS_asyncBit = 0;
+        if (DS_asyncReading)
+        {
+          *DS_asyncBuf = DS_asyncByte;
+        }
+        DS_asyncBuf++;
+        if (--DS_asyncLen == 0)
+        {
+          DS18B20_asyncFinish(DS_ASYNC_OK);
+          break;
+        }
+        if (!DS_asyncReading)
+        {
+          DS_asyncByte = *DS_asyncBuf;
+        }
+      }
+      DS18B20_asyncSlot();
+      break;
+
+    default:
+      break;
+  }
+}
+
+/**
+ * @name DS18B20_asyncInitUSART()
+ * @return none
+ * @brief initialize the USART of the asynchronous engine, see DS_UART
+ */
+void DS18B20_asyncInitUSART(void)
+{
+  DS_UART_ROUTEREG = (DS_UART_ROUTEREG & ~DS_UART_PINROUTE_gm) | DS_UART_PINROUTE_gc;
+  DS_UART_XDIRSET;
+  DS_UART_TXPINPULLUP;
+  DS_asyncState = DS_STATE_IDLE;
+  DS_UART.BAUD  = DS_UART_BAUD_CALC(DS_UART_SLOTBAUD);
+  DS_UART.CTRLC = USART_CMODE_ASYNCHRONOUS_gc | USART_PMODE_DISABLED_gc | USART_SBMODE_1BIT_gc | USART_CHSIZE_8BIT_gc;
+  DS_UART.CTRLB = USART_TXEN_bm | USART_RXEN_bm | USART_ODME_bm;
+  DS_UART.CTRLA = USART_RXCIE_bm | USART_LBME_bm;
+  sei();
+}
+
+/**
+ * @name DS18B20_asyncReset()
+ * @param done - callback, receives DS_ASYNC_OK if a device answered
+ * @return uint8_t - 0 if started, 1 if the engine is busy
+ * @brief starts a bus reset with presence detection
+ */
+uint8_t DS18B20_asyncReset(DS_callback_t done)
+{
+  if (DS18B20_asyncBusy())
+  {
+    return 1;
+  }
+  DS_asyncDone = done;
+  DS_asyncState = DS_STATE_RESET;
+  DS_UART.BAUD = DS_UART_BAUD_CALC(DS_UART_RESETBAUD);
+  DS_UART.TXDATAL = 0xF0;
+  return 0;
+}
+
+/**
+ * @name DS18B20_asyncBegin()
+ * @return none
+ * @brief sends the character of the first time slot of a transfer
+ * @note internal use, called by ds18b20_async.c
+ */
+void DS18B20_asyncBegin(void)
+{
+  DS_asyncState = DS_STATE_SLOT;
+  DS18B20_asyncSlot();
+}
@@ -4,6 +4,7 @@
 #include <stdio.h>
 #include <string.h>
 #include <ds18b20.h>
+#include <ds18b20_cache.h>
 
 // LCD debug buffer
 char buffer[40];
@@ -38,10 +39,8 @@ void setup(void)
 
   //============================================================
   DS18B20_init(&PORTA, 6);
-  if (DS18B20_reset() == 0)
-  {
-    DS18B20_scanBus();
-  }
+  DS18B20_startup();    // stored list of devices, full search only if needed
+  DS18B20_readPowerSupply(); // parasite powered devices can not be polled
 
       LCD_setCursor(0,0);
       sprintf(buffer, "%3d DS18B20 found", DS_devcount);
@@ -66,15 +65,14 @@ int main(void)
     uint16_t i=0;
     uint16_t dummy;
     int16_t temperature;
+    int16_t temps[DS_MAX_DEVICES];
     LCD_clear();
     while (1)
     {
       dummy = i*4;
 
       // start conversion on all DS18B20 units
-      DS18B20_reset();
-      DS18B20_write(DS18B20_CMD_SKIPROM);
-      DS18B20_write(DS18B20_CMD_CONVERTTEMP);
+      DS18B20_startConversion();
 
       LCD_setCursor(0,0);
       sprintf(buffer, "%4d Vs=%2ld.%03ld V", i, dummy/1000UL, dummy%1000UL);
@@ -84,21 +82,25 @@ int main(void)
       _delay_ms(1);
       ADC0_COMMAND |= ADC_STCONV_bm;
       while (ADC0_COMMAND & ADC_STCONV_bm);
-      while(!DS18B20_readBit()) {_delay_us(1000);}
-      DS18B20_reset();
-      DS18B20_select(DS_addresses[0]); //first DS18B20 in list
-      DS18B20_write(DS18B20_CMD_RSCRATCHPAD);
-      //Read Scratchpad (only 2 first bytes)
-      temperature  = DS18B20_read();
-      temperature |= (DS18B20_read() << 8);
+      // wait for the end of the conversion, then read all DS18B20 units
+      DS18B20_waitConversion(DS18B20_WAIT_POLL);
+      DS18B20_readAll(temps);
+      temperature = temps[0]; //first DS18B20 in list
 
       dummy = ADC0.RES;
       LCD_setCursor(0,1);
-      sprintf(buffer, "%3dC Vr=%2ld.%03ld V", temperature/16, dummy/1000UL, dummy%1000UL);
+      // integer conversion and formatting of the temperature, no float
+      DS18B20_format(DS18B20_centi(temperature, DS_resolution), buffer, 0);
+      for (uint8_t n=strlen(buffer); n<3; n++)
+      {
+        LCD_print(" ");
+      }
+      LCD_print(buffer);
+      sprintf(buffer, "C Vr=%2ld.%03ld V", dummy/1000UL, dummy%1000UL);
       LCD_print(buffer);
 
       i = (i+1) % 1024;
       _delay_ms(100);
     }
 
-}
\ No newline at end of file
+}
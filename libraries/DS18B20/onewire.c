@@ -0,0 +1,371 @@
+/**
+ * @file onewire.c
+ * @brief generic 1-wire bus master for AVR-Dx series
+ *
+ * @author Uwe Zimmermann
+ *
+ * The library work is licensed under a MIT license.\n
+ * See https://github.com/uwezi/AVR-Dx
+ *
+ * See Maxim application note 126 for the timing
+ *
+ * ChangeLog:
+ * --------
+ * * 2026-10-18 created from the pin and byte functions of ds18b20.c
+ */
+
+#include <onewire.h>
+
+/**
+ * @brief globals
+ */
+volatile PORT_t *OW_PORT;
+uint8_t  OW_PIN_bm;
+uint8_t  OW_speed = OW_SPEED_STANDARD;
+
+/**
+ * @name OW_init()
+ * @param ow_port - PORT-module for the 1-wire devices
+ * @param pin - PIN number for the 1-wire devices 0..7
+ * @return none
+ * @brief initialize PORT for 1-wire communication at standard speed
+ */
+void OW_init(volatile PORT_t *ow_port, uint8_t pin)
+{
+  OW_PORT   = ow_port;
+  OW_PIN_bm = 1 << pin;
+  OW_speed  = OW_SPEED_STANDARD;
+  OW_PORT->PINCONFIG = PORT_PULLUPEN_bm | PORT_ISC_INTDISABLE_gc;
+  OW_PORT->PINCTRLUPD = OW_PIN_bm;
+#ifdef OW_SPU_PORT
+  OW_SPU_PORT.OUTSET = OW_SPU_PIN_bm;   // MOSFET off
+  OW_SPU_PORT.DIRSET = OW_SPU_PIN_bm;
+#endif
+}
+
+#ifndef OW_SIM
+/*
+ * pin level interface, the host simulator in sim/ provides its own versions
+ * of OW_set(), OW_release(), OW_get() and OW_strongPullup()
+ */
+
+/**
+ * @name OW_set()
+ * @brief set the pin to 0 and declare as output
+ * @note internal use
+ */
+void OW_set(void)
+{
+  OW_PORT->DIRSET = OW_PIN_bm;
+  OW_PORT->OUTCLR = OW_PIN_bm;
+}
+
+/**
+ * @name OW_release()
+ * @brief release the port pin, keep pull-up active
+ * @note internal use
+ */
+void OW_release(void)
+{
+  OW_PORT->DIRCLR = OW_PIN_bm;
+}
+
+/**
+ * @name OW_get()
+ * @return uint8_t state of the pin 1/0
+ * @brief reads the state of the 1-wire line
+ * @note internal use
+ */
+uint8_t OW_get(void)
+{
+  return (OW_PORT->IN & OW_PIN_bm) ? 1 : 0;
+}
+
+/**
+ * @name OW_strongPullup()
+ * @param on - 1 to connect the bus to VDD, 0 to return to the pull-up resistor
+ * @return none
+ * @brief supplies the current of parasite powered devices, e.g. during a
+ *        temperature conversion or an EEPROM write
+ */
+void OW_strongPullup(uint8_t on)
+{
+#ifdef OW_SPU_PORT
+  if (on)
+  {
+    OW_SPU_PORT.OUTCLR = OW_SPU_PIN_bm;
+  }
+  else
+  {
+    OW_SPU_PORT.OUTSET = OW_SPU_PIN_bm;
+  }
+#else
+  if (on)
+  {                                 // push-pull high, no low glitch
+    OW_PORT->OUTSET = OW_PIN_bm;
+    OW_PORT->DIRSET = OW_PIN_bm;
+  }
+  else
+  {
+    OW_PORT->DIRCLR = OW_PIN_bm;
+    OW_PORT->OUTCLR = OW_PIN_bm;
+  }
+#endif
+}
+#endif // OW_SIM
+
+/**
+ * @name OW_reset()
+ * @return uint8_t returns the state of the 1-wire line after a bus-reset,
+ *         0 if at least one device answered with a presence pulse
+ * @brief resets the 1-wire bus with the timing of OW_speed
+ */
+uint8_t OW_reset(void)
+{
+  uint8_t result = 1;
+
+  if (OW_speed == OW_SPEED_OVERDRIVE)
+  {                                 // the presence pulse starts after 2 µs
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+      OW_set();
+      _delay_us(70);
+      OW_release();
+      _delay_us(8.5);
+      result = OW_get();
+      _delay_us(40);
+    }
+  }
+  else
+  {
+    OW_set();
+    _delay_us(480);
+    OW_release();
+    _delay_us(60);
+    result = OW_get();
+    _delay_us(420);
+  }
+  return result;
+}
+
+/**
+ * @name OW_writeBit()
+ * @param bit - the bit to write 1/0
+ * @return none
+ * @brief writes a bit on the 1-wire bus
+ * @note internal use, call with disabled interrupts
+ */
+void OW_writeBit(uint8_t bit)
+{
+  OW_set();
+  _delay_us(1);
+  if (bit > 0)
+  {
+    OW_release();
+  }
+  if (OW_speed == OW_SPEED_OVERDRIVE)
+  {
+    _delay_us(7.5);
+    OW_release();
+    _delay_us(2.5);
+  }
+  else
+  {
+    _delay_us(59);
+    OW_release();
+    _delay_us(1);
+  }
+}
+
+/**
+ * @name OW_readBit()
+ * @return uint8_t - value of the bit 1/0
+ * @brief triggers the reading of a single bit from the devices
+ * @note internal use, call with disabled interrupts
+ */
+uint8_t OW_readBit(void)
+{
+  uint8_t result;
+
+  OW_set();
+  _delay_us(1);
+  OW_release();
+  if (OW_speed == OW_SPEED_OVERDRIVE)
+  {                                 // valid for 2 µs after the falling edge
+    _delay_us(1);
+    result = OW_get();
+    _delay_us(7);
+  }
+  else
+  {
+    _delay_us(10);                  // valid for 15 µs after the falling edge
+    result = OW_get();
+    _delay_us(50);
+  }
+  return result;
+}
+
+/**
+ * @name OW_write()
+ * @param byte - data to be written to the 1-wire devices
+ * @return none
+ * @brief writes one byte of data on the 1-wire bus
+ */
+void OW_write(uint8_t byte)
+{  // LSB first
+  uint8_t i;
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    for (i=8; i>0; i--)
+    {
+      OW_writeBit(byte & 0b00000001);
+      byte >>= 1;
+    }
+  }
+}
+
+/**
+ * @name OW_read()
+ * @return uint8_t - value returned by the device, 1 byte
+ * @brief triggers the reading of a single byte from the device
+ */
+uint8_t OW_read(void)
+{  // LSB first
+  uint8_t i, result=0;
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    for (i=8; i>0; i--)
+    {
+      result >>= 1;
+      result |= (OW_readBit() & 0b00000001) << 7;
+    }
+  }
+  return result;
+}
+
+/**
+ * @name OW_writeBlock()
+ * @param data - bytes to be written
+ * @param count - number of bytes
+ * @return none
+ * @brief writes a block of bytes, the interrupts are disabled per byte
+ */
+void OW_writeBlock(const uint8_t *data, uint16_t count)
+{
+  while (count--)
+  {
+    OW_write(*data++);
+  }
+}
+
+/**
+ * @name OW_readBlock()
+ * @param data - receives the bytes
+ * @param count - number of bytes
+ * @return none
+ * @brief reads a block of bytes, the interrupts are disabled per byte
+ */
+void OW_readBlock(uint8_t *data, uint16_t count)
+{
+  while (count--)
+  {
+    *data++ = OW_read();
+  }
+}
+
+/**
+ * @name OW_sendROM()
+ * @param address 64-bit ID address, LSB first
+ * @brief writes the 8 bytes of a ROM code
+ */
+static void OW_sendROM(uint64_t address)
+{
+  uint8_t i;
+  for (i=0; i<8; i++)
+  {
+    OW_write(address & 0xff);
+    address >>= 8;
+  }
+}
+
+/**
+ * @name OW_select()
+ * @param address 64-bit ID address of the desired device
+ * @return none
+ * @brief selects one 1-wire device on the bus for subsequent activities
+ *        (MATCHROM at the current speed), call after OW_reset()
+ */
+void OW_select(uint64_t address)
+{
+  OW_write(OW_CMD_MATCHROM);
+  OW_sendROM(address);
+}
+
+/**
+ * @name OW_skip()
+ * @return none
+ * @brief selects all devices on the bus (SKIPROM), call after OW_reset()
+ */
+void OW_skip(void)
+{
+  OW_write(OW_CMD_SKIPROM);
+}
+
+/**
+ * @name OW_readROM()
+ * @return uint64_t - ROM code of the only device on the bus
+ * @brief READROM, call after OW_reset(); with more than one device the
+ *        result is the AND of all ROM codes
+ */
+uint64_t OW_readROM(void)
+{
+  uint64_t address = 0;
+  uint8_t i;
+
+  OW_write(OW_CMD_READROM);
+  for (i=0; i<8; i++)
+  {
+    address |= (uint64_t)OW_read() << (8*i);
+  }
+  return address;
+}
+
+/**
+ * @name OW_overdriveSkip()
+ * @return uint8_t state of the 1-wire line after the bus-reset, 0 if at
+ *         least one device is present
+ * @brief standard speed reset and OVERDRIVE SKIP ROM: all devices with
+ *        overdrive are selected and switch to overdrive speed, so does the
+ *        master
+ */
+uint8_t OW_overdriveSkip(void)
+{
+  uint8_t result;
+
+  OW_speed = OW_SPEED_STANDARD;
+  result = OW_reset();
+  OW_write(OW_CMD_ODSKIPROM);
+  OW_speed = OW_SPEED_OVERDRIVE;
+  return result;
+}
+
+/**
+ * @name OW_overdriveSelect()
+ * @param address 64-bit ID address of the desired device
+ * @return uint8_t state of the 1-wire line after the bus-reset, 0 if at
+ *         least one device is present
+ * @brief standard speed reset and OVERDRIVE MATCH ROM: the command is sent
+ *        at standard speed, the ROM code at overdrive speed; the addressed
+ *        device stays at overdrive speed until the next standard reset
+ */
+uint8_t OW_overdriveSelect(uint64_t address)
+{
+  uint8_t result;
+
+  OW_speed = OW_SPEED_STANDARD;
+  result = OW_reset();
+  OW_write(OW_CMD_ODMATCHROM);
+  OW_speed = OW_SPEED_OVERDRIVE;
+  OW_sendROM(address);
+  return result;
+}
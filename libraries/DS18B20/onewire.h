@@ -0,0 +1,217 @@
+/**
+ * @file onewire.h
+ * @brief generic 1-wire bus master for AVR-Dx series
+ *
+ * @author Uwe Zimmermann
+ *
+ * The library work is licensed under a MIT license.\n
+ * See https://github.com/uwezi/AVR-Dx
+ *
+ * Bit-banged 1-wire master on any GPIO pin with the standard and the
+ * overdrive timing of Maxim application note 126, the ROM commands and block
+ * transfers. The DS18B20 driver in ds18b20.c is built on top of it, other
+ * devices on the same bus (DS2431, DS2408, ...) can be accessed directly.
+ *
+ * Overdrive:
+ * OW_overdriveSkip() and OW_overdriveSelect() switch the addressed devices
+ * and the master to overdrive speed, all following resets and time slots are
+ * about 10 times shorter. Devices without overdrive (e.g. the DS18B20) wait
+ * for the next reset and ignore this traffic. A reset with standard timing
+ * returns all devices to standard speed:
+ *
+ *   OW_speed = OW_SPEED_STANDARD;
+ *   OW_reset();
+ *
+ * The overdrive slots are only 10 µs long, the pin functions must be
+ * reached within about 1 µs: F_CPU should be at least 16 MHz.
+ *
+ * ChangeLog:
+ * --------
+ * * 2026-10-18 created from the pin and byte functions of ds18b20.c
+ */
+
+#ifndef onewire_h
+#define onewire_h
+
+#include <avr/io.h>
+#include <util/delay.h>
+#include <util/atomic.h>
+
+/**
+ * port and pin of the 1-wire bus, set by OW_init()
+ */
+extern volatile PORT_t *OW_PORT;
+extern uint8_t  OW_PIN_bm;
+
+/**
+ * timing profile of the following resets and time slots
+ */
+#define OW_SPEED_STANDARD  0 //!< 480 µs reset, 61 µs slots
+#define OW_SPEED_OVERDRIVE 1 //!< 70 µs reset, 10 µs slots
+extern uint8_t OW_speed;
+
+/**
+ * optional strong pull-up for parasite powered devices
+ * - not defined: the 1-wire pin itself is driven high
+ * - OW_SPU_PORT/OW_SPU_PIN_bm defined: an output pin switching a P-MOSFET
+ *   between VDD and the bus, active low
+ */
+//#define OW_SPU_PORT   PORTA
+//#define OW_SPU_PIN_bm PIN7_bm
+
+/**
+ * ROM command constants, common to all 1-wire devices
+ */
+#define OW_CMD_SEARCHROM   0xf0 //!< determines 1-wire bus addresses
+#define OW_CMD_READROM     0x33 //!< if only one slave: read bus address
+#define OW_CMD_MATCHROM    0x55 //!< select a single slave device
+#define OW_CMD_SKIPROM     0xcc //!< select all devices on the bus
+#define OW_CMD_ALARMSEARCH 0xec //!< like SEARCHROM but only devices with active alarm will react
+#define OW_CMD_RESUME      0xa5 //!< select the device addressed last
+#define OW_CMD_ODSKIPROM   0x3c //!< SKIPROM, devices with overdrive switch speed
+#define OW_CMD_ODMATCHROM  0x69 //!< MATCHROM, the ROM code is sent at overdrive speed
+
+/**
+ * @name OW_init()
+ * @param ow_port - PORT-module for the 1-wire devices
+ * @param pin - PIN number for the 1-wire devices 0..7
+ * @return none
+ * @brief initialize PORT for 1-wire communication at standard speed
+ */
+void OW_init(volatile PORT_t *ow_port, uint8_t pin);
+
+/**
+ * @name OW_set()
+ * @brief set the pin to 0 and declare as output
+ * @note internal use
+ */
+void OW_set(void);
+
+/**
+ * @name OW_release()
+ * @brief release the port pin, keep pull-up active
+ * @note internal use
+ */
+void OW_release(void);
+
+/**
+ * @name OW_get()
+ * @return uint8_t state of the pin 1/0
+ * @brief reads the state of the 1-wire line
+ * @note internal use
+ */
+uint8_t OW_get(void);
+
+/**
+ * @name OW_strongPullup()
+ * @param on - 1 to connect the bus to VDD, 0 to return to the pull-up resistor
+ * @return none
+ * @brief supplies the current of parasite powered devices, e.g. during a
+ *        temperature conversion or an EEPROM write
+ */
+void OW_strongPullup(uint8_t on);
+
+/**
+ * @name OW_reset()
+ * @return uint8_t returns the state of the 1-wire line after a bus-reset,
+ *         0 if at least one device answered with a presence pulse
+ * @brief resets the 1-wire bus with the timing of OW_speed
+ */
+uint8_t OW_reset(void);
+
+/**
+ * @name OW_writeBit()
+ * @param bit - the bit to write 1/0
+ * @return none
+ * @brief writes a bit on the 1-wire bus
+ * @note internal use, call with disabled interrupts
+ */
+void OW_writeBit(uint8_t bit);
+
+/**
+ * @name OW_readBit()
+ * @return uint8_t - value of the bit 1/0
+ * @brief triggers the reading of a single bit from the devices
+ * @note internal use, call with disabled interrupts
+ */
+uint8_t OW_readBit(void);
+
+/**
+ * @name OW_write()
+ * @param byte - data to be written to the 1-wire devices
+ * @return none
+ * @brief writes one byte of data on the 1-wire bus
+ */
+void OW_write(uint8_t byte);
+
+/**
+ * @name OW_read()
+ * @return uint8_t - value returned by the device, 1 byte
+ * @brief triggers the reading of a single byte from the device
+ */
+uint8_t OW_read(void);
+
+/**
+ * @name OW_writeBlock()
+ * @param data - bytes to be written
+ * @param count - number of bytes
+ * @return none
+ * @brief writes a block of bytes, the interrupts are disabled per byte
+ */
+void OW_writeBlock(const uint8_t *data, uint16_t count);
+
+/**
+ * @name OW_readBlock()
+ * @param data - receives the bytes
+ * @param count - number of bytes
+ * @return none
+ * @brief reads a block of bytes, the interrupts are disabled per byte
+ */
+void OW_readBlock(uint8_t *data, uint16_t count);
+
+/**
+ * @name OW_select()
+ * @param address 64-bit ID address of the desired device
+ * @return none
+ * @brief selects one 1-wire device on the bus for subsequent activities
+ *        (MATCHROM at the current speed), call after OW_reset()
+ */
+void OW_select(uint64_t address);
+
+/**
+ * @name OW_skip()
+ * @return none
+ * @brief selects all devices on the bus (SKIPROM), call after OW_reset()
+ */
+void OW_skip(void);
+
+/**
+ * @name OW_readROM()
+ * @return uint64_t - ROM code of the only device on the bus
+ * @brief READROM, call after OW_reset(); with more than one device the
+ *        result is the AND of all ROM codes
+ */
+uint64_t OW_readROM(void);
+
+/**
+ * @name OW_overdriveSkip()
+ * @return uint8_t state of the 1-wire line after the bus-reset, 0 if at
+ *         least one device is present
+ * @brief standard speed reset and OVERDRIVE SKIP ROM: all devices with
+ *        overdrive are selected and switch to overdrive speed, so does the
+ *        master
+ */
+uint8_t OW_overdriveSkip(void);
+
+/**
+ * @name OW_overdriveSelect()
+ * @param address 64-bit ID address of the desired device
+ * @return uint8_t state of the 1-wire line after the bus-reset, 0 if at
+ *         least one device is present
+ * @brief standard speed reset and OVERDRIVE MATCH ROM: the command is sent
+ *        at standard speed, the ROM code at overdrive speed; the addressed
+ *        device stays at overdrive speed until the next standard reset
+ */
+uint8_t OW_overdriveSelect(uint64_t address);
+
+#endif
@@ -0,0 +1,31 @@
+/**
+ * @file avr/io.h
+ * @brief host replacement of <avr/io.h> for the 1-wire simulator
+ *
+ * Only the PORT registers used by ds18b20.c exist, they are plain memory.
+ * The 1-wire pin itself is handled by the pin functions in ds18b20_sim.c.
+ */
+
+#ifndef sim_avr_io_h
+#define sim_avr_io_h
+
+#include <stdint.h>
+
+#ifndef F_CPU
+#define F_CPU 4000000UL
+#endif
+
+typedef struct
+{
+  uint8_t DIR, DIRSET, DIRCLR, DIRTGL;
+  uint8_t OUT, OUTSET, OUTCLR, OUTTGL;
+  uint8_t IN, INTFLAGS, PORTCTRL;
+  uint8_t PINCONFIG, PINCTRLUPD, PINCTRLSET, PINCTRLCLR;
+} PORT_t;
+
+extern PORT_t PORTA;
+
+#define PORT_PULLUPEN_bm       0x08
+#define PORT_ISC_INTDISABLE_gc 0x00
+
+#endif
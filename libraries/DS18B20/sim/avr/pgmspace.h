@@ -0,0 +1,12 @@
+/**
+ * @file avr/pgmspace.h
+ * @brief host replacement of <avr/pgmspace.h> for the 1-wire simulator
+ */
+
+#ifndef sim_avr_pgmspace_h
+#define sim_avr_pgmspace_h
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+
+#endif
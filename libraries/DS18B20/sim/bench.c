@@ -0,0 +1,133 @@
+/**
+ * @file bench.c
+ * @brief benchmark of the DS18B20 library on the simulated 1-wire bus
+ *
+ * @author Uwe Zimmermann
+ *
+ * The library work is licensed under a MIT license.\n
+ * See https://github.com/uwezi/AVR-Dx
+ *
+ * Build and run on the host, see readme.md:
+ * gcc -std=gnu99 -O2 -DOW_SIM -DDS_MAX_DEVICES=256 -Isim -I. \
+ *     sim/bench.c sim/ds18b20_sim.c onewire.c ds18b20.c -o ds18b20_bench
+ *
+ * ChangeLog:
+ * --------
+ * * 2026-10-18 created.
+ * * 2026-10-18 replaces the pin functions of onewire.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <ds18b20.h>
+#include <ds18b20_sim.h>
+
+static int16_t temps[DS_MAX_DEVICES];
+static int16_t model[SIM_MAX_DEVICES];
+static uint64_t roms[SIM_MAX_DEVICES];
+
+/**
+ * @name bench_bus()
+ * @brief fills the bus with n devices with random ROM codes and temperatures
+ */
+static void bench_bus(uint16_t n, uint8_t parasite)
+{
+  SIM_clear();
+  DS18B20_init(&PORTA, 6);
+  for (uint16_t i=0; i<n; i++)
+  {
+    roms[i] = SIM_makeROM(DS18B20_FAMILY, ((uint64_t)rand() << 24) ^ rand());
+    model[i] = rand() % 6000 - 1000;
+    SIM_addDevice(roms[i], model[i], parasite);
+  }
+}
+
+/**
+ * @name bench_check()
+ * @return uint16_t - number of devices missing in DS_addresses[] or with a
+ *         wrong temperature in temps[]
+ */
+static uint16_t bench_check(uint16_t n, uint8_t temperatures)
+{
+  uint16_t errors = 0;
+  int16_t  index, expect;
+
+  for (uint16_t i=0; i<n; i++)
+  {
+    index = DS18B20_find(roms[i]);
+    if (index < 0)
+    {
+      errors++;
+      continue;
+    }
+    if (temperatures)
+    {
+      expect = (model[i] * 16 + ((model[i] < 0) ? -50 : 50)) / 100;
+      if (temps[index] != expect)
+      {
+        errors++;
+      }
+    }
+  }
+  return errors;
+}
+
+/**
+ * @name bench_print()
+ */
+static void bench_print(const char *what, uint16_t n, uint16_t errors)
+{
+  printf("%-12s %4u %10.1f %10.1f %8.0f %7u %6u %6u\n", what, n,
+         SIM_stats.busTime / 1000, SIM_stats.irqOffTime / 1000, SIM_stats.irqOffMax,
+         SIM_stats.slots, SIM_stats.violations, errors);
+}
+
+int main(void)
+{
+  static const uint16_t sizes[] = {1, 2, 4, 8, 16, 32, 64, 128, 256};
+  uint16_t n, errors;
+
+  srand(1);
+  printf("%-12s %4s %10s %10s %8s %7s %6s %6s\n", "", "dev", "bus ms", "irq-off ms",
+         "max µs", "slots", "viol", "errors");
+  for (uint8_t s=0; s<sizeof(sizes)/sizeof(sizes[0]); s++)
+  {
+    n = sizes[s];
+    bench_bus(n, 0);
+
+    SIM_clearStats();
+    DS18B20_scanBus();
+    bench_print("scanBus", n, bench_check(n, 0) + (DS_devcount != n));
+
+    SIM_clearStats();
+    DS18B20_acquire(temps, DS18B20_WAIT_POLL);
+    bench_print("acquire", n, bench_check(n, 1));
+  }
+
+  printf("\nnoise: 1 of 1000 read slots corrupted, %d retries\n", DS_RETRIES);
+  for (uint8_t s=4; s<7; s++)
+  {
+    n = sizes[s];
+    bench_bus(n, 0);
+    SIM_noise = 0.001;
+    DS_stats = (DS_stats_t){0};
+    SIM_clearStats();
+    DS18B20_scanBus();
+    errors = bench_check(n, 0) + (DS_devcount != n);
+    DS18B20_acquire(temps, DS18B20_WAIT_POLL);
+    errors += bench_check(n, 1);
+    bench_print("scan+acquire", n, errors);
+    printf("%-12s crc errors %u, retries %u, failures %u\n", "",
+           DS_stats.crcErrors, DS_stats.retries, DS_stats.failures);
+    SIM_noise = 0;
+  }
+
+  printf("\nparasite power\n");
+  bench_bus(8, 1);
+  DS18B20_scanBus();
+  DS18B20_readPowerSupply();
+  SIM_clearStats();
+  DS18B20_acquire(temps, DS18B20_WAIT_POLL);
+  bench_print("acquire", 8, bench_check(8, 1) + !DS_parasite);
+  return 0;
+}
@@ -0,0 +1,627 @@
+/**
+ * @file ds18b20_sim.c
+ * @brief host simulator of a 1-wire bus with virtual DS18B20 devices
+ *
+ * @author Uwe Zimmermann
+ *
+ * The library work is licensed under a MIT license.\n
+ * See https://github.com/uwezi/AVR-Dx
+ *
+ * See ds18b20_sim.h
+ *
+ * ChangeLog:
+ * --------
+ * * 2026-10-18 created.
+ * * 2026-10-18 replaces the pin functions of onewire.c
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <ds18b20.h>
+#include <ds18b20_sim.h>
+
+/**
+ * @brief states of a virtual device
+ * @note internal use
+ */
+enum
+{
+  DEV_IDLE = 0,   // not selected, waits for the next reset
+  DEV_ROMCMD,     // receives the ROM command
+  DEV_MATCH,      // receives the ROM code of MATCH ROM
+  DEV_SEARCH,     // takes part in SEARCH ROM or ALARM SEARCH
+  DEV_FUNCCMD,    // receives the function command
+  DEV_SEND,       // sends shift[], ROM code or scratchpad
+  DEV_RECV,       // receives TH, TL and configuration
+  DEV_CONVERT,    // answers read slots with the conversion status
+  DEV_POWER       // answers read slots with the power supply mode
+};
+
+/**
+ * @brief a virtual DS18B20
+ * @note internal use
+ */
+typedef struct
+{
+  uint64_t rom;
+  int16_t  centi;         // temperature of the device
+  uint8_t  present;
+  uint8_t  parasite;
+  uint8_t  scratchpad[9];
+  uint8_t  eeprom[3];     // TH, TL, configuration
+  uint8_t  state;
+  uint8_t  next;          // state after DEV_SEND
+  uint8_t  bits;          // bits received or sent in this state
+  uint8_t  length;        // bits to send in DEV_SEND
+  uint8_t  phase;         // DEV_SEARCH: 0 bit, 1 complement, 2 direction
+  uint8_t  shift[9];
+  double   convEnd;       // end of the running conversion, 0 if none
+  int16_t  convRaw;       // result of the running conversion
+  uint8_t  convPowered;   // strong pull-up seen during the conversion
+  uint8_t  convFailed;
+} SIM_device_t;
+
+/**
+ * @brief globals
+ */
+PORT_t      PORTA;
+double      SIM_holdTime   = 30;
+double      SIM_convFactor = 0.85;
+double      SIM_noise      = 0;
+int16_t     SIM_tempNoise  = 0;
+SIM_stats_t SIM_stats;
+
+static SIM_device_t SIM_devices[SIM_MAX_DEVICES];
+static int16_t SIM_count;
+static double  SIM_now;
+static double  SIM_lowStart;      // start of the low pulse of the master, <0: released
+static double  SIM_slotStart;     // start of the current time slot
+static double  SIM_prevSlot;      // start of the previous time slot
+static double  SIM_presenceStart;
+static double  SIM_presenceEnd;
+static uint8_t SIM_slotDrive;     // a device sends a 0 in the current slot
+static uint8_t SIM_slotNoise;     // the current slot is corrupted
+static uint8_t SIM_slotSampled;
+static uint8_t SIM_irqDepth;
+static double  SIM_irqStart;
+
+/**
+ * @name SIM_crc8()
+ * @brief Dallas/Maxim CRC-8, bit by bit
+ * @note internal use
+ */
+static uint8_t SIM_crc8(const uint8_t *data, uint8_t len)
+{
+  uint8_t crc = 0;
+  while (len--)
+  {
+    crc ^= *data++;
+    for (uint8_t i=0; i<8; i++)
+    {
+      crc = (crc & 1) ? (crc >> 1) ^ 0x8c : crc >> 1;
+    }
+  }
+  return crc;
+}
+
+uint64_t SIM_makeROM(uint8_t family, uint64_t serial)
+{
+  uint8_t bytes[8];
+  uint64_t rom = family | ((serial & 0xffffffffffffULL) << 8);
+
+  for (uint8_t i=0; i<7; i++)
+  {
+    bytes[i] = rom >> (8*i);
+  }
+  return rom | ((uint64_t)SIM_crc8(bytes, 7) << 56);
+}
+
+/**
+ * @name SIM_convTime()
+ * @brief conversion time in µs for the configuration register
+ * @note internal use
+ */
+static double SIM_convTime(uint8_t config)
+{
+  return 93750.0 * (1 << ((config >> 5) & 3)) * SIM_convFactor;
+}
+
+/**
+ * @name SIM_violation()
+ * @note internal use
+ */
+static void SIM_violation(void)
+{
+  SIM_stats.violations++;
+}
+
+/**
+ * @name SIM_finish()
+ * @brief copies the result of a finished conversion into the scratchpad
+ * @note internal use
+ */
+static void SIM_finish(SIM_device_t *d)
+{
+  if ((d->convEnd > 0) && (SIM_now >= d->convEnd))
+  {
+    if (d->parasite && !d->convPowered)
+    {
+      d->convFailed = 1;
+    }
+    if (!d->convFailed)
+    {
+      d->scratchpad[0] = d->convRaw;
+      d->scratchpad[1] = d->convRaw >> 8;
+      d->scratchpad[8] = SIM_crc8(d->scratchpad, 8);
+    }
+    d->convEnd = 0;
+  }
+}
+
+/**
+ * @name SIM_parasiteCheck()
+ * @brief a parasite powered device loses its conversion if the bus is not
+ *        held high until the end
+ * @note internal use
+ */
+static void SIM_parasiteCheck(void)
+{
+  for (int16_t i=0; i<SIM_count; i++)
+  {
+    SIM_device_t *d = &SIM_devices[i];
+    SIM_finish(d);
+    if (d->present && d->parasite && (d->convEnd > 0) && !d->convFailed)
+    {
+      d->convFailed = 1;
+      SIM_violation();
+    }
+  }
+}
+
+/**
+ * @name SIM_convert()
+ * @brief starts a conversion of a device
+ * @note internal use
+ */
+static void SIM_convert(SIM_device_t *d)
+{
+  int32_t centi = d->centi;
+  int16_t raw;
+  uint8_t undefined = 3 - ((d->scratchpad[4] >> 5) & 3);
+
+  if (SIM_tempNoise)
+  {
+    centi += rand() % (2 * SIM_tempNoise + 1) - SIM_tempNoise;
+  }
+  // round to 1/16 °C, the low bits are undefined at lower resolutions
+  raw = (centi * 16 + ((centi < 0) ? -50 : 50)) / 100;
+  d->convRaw = raw & ~((1 << undefined) - 1);
+  d->convEnd = SIM_now + SIM_convTime(d->scratchpad[4]);
+  d->convPowered = 0;
+  d->convFailed = 0;
+  d->state = DEV_CONVERT;
+}
+
+/**
+ * @name SIM_send()
+ * @brief prepares a device to send bytes
+ * @note internal use
+ */
+static void SIM_send(SIM_device_t *d, const uint8_t *bytes, uint8_t len, uint8_t next)
+{
+  memcpy(d->shift, bytes, len);
+  d->length = 8 * len;
+  d->bits = 0;
+  d->next = next;
+  d->state = DEV_SEND;
+}
+
+/**
+ * @name SIM_deviceBit()
+ * @return uint8_t - the bit the device sends in the slot which starts now,
+ *         1 if it does not send
+ * @note internal use
+ */
+static uint8_t SIM_deviceBit(SIM_device_t *d)
+{
+  uint8_t bit;
+
+  switch (d->state)
+  {
+    case DEV_SEARCH:
+      bit = (d->rom >> d->bits) & 1;
+      return (d->phase == 0) ? bit : (d->phase == 1) ? !bit : 1;
+    case DEV_SEND:
+      return (d->shift[d->bits / 8] >> (d->bits % 8)) & 1;
+    case DEV_CONVERT:
+      return d->parasite || (SIM_now >= d->convEnd);
+    case DEV_POWER:
+      return !d->parasite;
+    default:
+      return 1;
+  }
+}
+
+/**
+ * @name SIM_command()
+ * @brief executes a function command
+ * @note internal use
+ */
+static void SIM_command(SIM_device_t *d, uint8_t cmd)
+{
+  d->bits = 0;
+  switch (cmd)
+  {
+    case DS18B20_CMD_CONVERTTEMP:
+      SIM_convert(d);
+      break;
+    case DS18B20_CMD_RSCRATCHPAD:
+      SIM_finish(d);
+      SIM_send(d, d->scratchpad, 9, DEV_IDLE);
+      break;
+    case DS18B20_CMD_WSCRATCHPAD:
+      memset(d->shift, 0, sizeof(d->shift));
+      d->state = DEV_RECV;
+      break;
+    case DS18B20_CMD_CPYSCRATCHPAD:
+      memcpy(d->eeprom, &d->scratchpad[2], 3);
+      d->state = DEV_IDLE;
+      break;
+    case DS18B20_CMD_RECEEPROM:
+      memcpy(&d->scratchpad[2], d->eeprom, 3);
+      d->scratchpad[8] = SIM_crc8(d->scratchpad, 8);
+      d->state = DEV_IDLE;
+      break;
+    case DS18B20_CMD_RPWRSUPPLY:
+      d->state = DEV_POWER;
+      break;
+    default:
+      d->state = DEV_IDLE;
+      break;
+  }
+}
+
+/**
+ * @name SIM_alarm()
+ * @return uint8_t - 1 if the last conversion is outside TL..TH
+ * @note internal use
+ */
+static uint8_t SIM_alarm(SIM_device_t *d)
+{
+  int16_t t = (int16_t)(d->scratchpad[0] | (d->scratchpad[1] << 8)) >> 4;
+  return (t >= (int8_t)d->scratchpad[2]) || (t <= (int8_t)d->scratchpad[3]);
+}
+
+/**
+ * @name SIM_deviceSlot()
+ * @param seen - the bit the device has sampled in this slot
+ * @brief advances the state of a device after a time slot
+ * @note internal use
+ */
+static void SIM_deviceSlot(SIM_device_t *d, uint8_t seen)
+{
+  uint8_t cmd;
+  uint8_t rombit = (d->rom >> d->bits) & 1;
+
+  switch (d->state)
+  {
+    case DEV_ROMCMD:
+    case DEV_FUNCCMD:
+      d->shift[0] = (d->shift[0] >> 1) | (seen << 7);
+      if (++d->bits < 8)
+      {
+        break;
+      }
+      cmd = d->shift[0];
+      if (d->state == DEV_FUNCCMD)
+      {
+        SIM_command(d, cmd);
+        break;
+      }
+      d->bits = 0;
+      d->phase = 0;
+      switch (cmd)
+      {
+        case DS18B20_CMD_SKIPROM:
+          d->state = DEV_FUNCCMD;
+          break;
+        case DS18B20_CMD_MATCHROM:
+          d->state = DEV_MATCH;
+          break;
+        case DS18B20_CMD_SEARCHROM:
+          d->state = DEV_SEARCH;
+          break;
+        case DS18B20_CMD_ALARMSEARCH:
+          SIM_finish(d);
+          d->state = SIM_alarm(d) ? DEV_SEARCH : DEV_IDLE;
+          break;
+        case DS18B20_CMD_READROM:
+          SIM_send(d, (const uint8_t *)&d->rom, 8, DEV_FUNCCMD);
+          break;
+        default:
+          d->state = DEV_IDLE;
+          break;
+      }
+      break;
+
+    case DEV_MATCH:
+      if (seen != rombit)
+      {
+        d->state = DEV_IDLE;
+      }
+      else if (++d->bits == 64)
+      {
+        d->bits = 0;
+        d->state = DEV_FUNCCMD;
+      }
+      break;
+
+    case DEV_SEARCH:
+      if (d->phase < 2)
+      {
+        d->phase++;
+      }
+      else if (seen != rombit)
+      {
+        d->state = DEV_IDLE;
+      }
+      else
+      {
+        d->phase = 0;
+        if (++d->bits == 64)
+        {
+          d->bits = 0;
+          d->state = DEV_FUNCCMD;
+        }
+      }
+      break;
+
+    case DEV_SEND:
+      if (++d->bits == d->length)
+      {
+        d->bits = 0;
+        d->shift[0] = 0;
+        d->state = d->next;
+      }
+      break;
+
+    case DEV_RECV:
+      d->shift[d->bits / 8] |= seen << (d->bits % 8);
+      if (++d->bits == 24)
+      {
+        d->scratchpad[2] = d->shift[0];
+        d->scratchpad[3] = d->shift[1];
+        d->scratchpad[4] = (d->shift[2] & DS18B20_CFG_gm) | 0x1f;
+        d->scratchpad[8] = SIM_crc8(d->scratchpad, 8);
+        d->state = DEV_IDLE;
+      }
+      break;
+
+    default:
+      break;
+  }
+}
+
+/**
+ * @name OW_set()
+ * @brief the master pulls the bus low
+ */
+void OW_set(void)
+{
+  if (SIM_lowStart >= 0)
+  {
+    return;
+  }
+  SIM_parasiteCheck();
+  SIM_lowStart = SIM_now;
+  SIM_prevSlot = SIM_slotStart;
+  SIM_slotStart = SIM_now;
+  SIM_slotSampled = 0;
+  SIM_slotDrive = 0;
+  for (int16_t i=0; i<SIM_count; i++)
+  {
+    if (SIM_devices[i].present && !SIM_deviceBit(&SIM_devices[i]))
+    {
+      SIM_slotDrive = 1;
+    }
+  }
+  SIM_slotNoise = (SIM_noise > 0) && (rand() < SIM_noise * RAND_MAX);
+}
+
+/**
+ * @name OW_release()
+ * @brief the master releases the bus, the devices evaluate the low pulse
+ */
+void OW_release(void)
+{
+  double  pulse;
+  uint8_t seen;
+
+  if (SIM_lowStart < 0)
+  {
+    return;
+  }
+  pulse = SIM_now - SIM_lowStart;
+  SIM_lowStart = -1;
+
+  if (pulse >= 480)
+  {                                   // bus reset
+    SIM_stats.resets++;
+    SIM_slotDrive = 0;
+    SIM_slotStart = -1e9;
+    for (int16_t i=0; i<SIM_count; i++)
+    {
+      SIM_devices[i].state = DEV_ROMCMD;
+      SIM_devices[i].bits = 0;
+      SIM_devices[i].shift[0] = 0;
+    }
+    for (int16_t i=0; i<SIM_count; i++)
+    {
+      if (SIM_devices[i].present)
+      {
+        SIM_presenceStart = SIM_now + 30;
+        SIM_presenceEnd = SIM_now + 150;
+        break;
+      }
+    }
+    return;
+  }
+  if ((pulse > 120) || (SIM_slotStart - SIM_prevSlot < 61))
+  {                                   // neither slot nor reset, or slots too close
+    SIM_violation();
+  }
+  SIM_stats.slots++;
+  // the devices sample the bus 15 µs after the falling edge
+  seen = !((pulse >= 15) || SIM_slotDrive);
+  for (int16_t i=0; i<SIM_count; i++)
+  {
+    if (SIM_devices[i].present)
+    {
+      SIM_deviceSlot(&SIM_devices[i], seen);
+    }
+  }
+}
+
+/**
+ * @name OW_get()
+ * @return uint8_t - state of the bus 1/0
+ */
+uint8_t OW_get(void)
+{
+  uint8_t low = (SIM_lowStart >= 0);
+
+  if ((SIM_now >= SIM_presenceStart) && (SIM_now < SIM_presenceEnd))
+  {
+    low = 1;
+  }
+  if ((SIM_now - SIM_slotStart) < 60)
+  {
+    if (SIM_slotDrive && (SIM_now - SIM_slotStart < SIM_holdTime))
+    {
+      low = 1;
+    }
+    if (!SIM_slotSampled)
+    {
+      SIM_slotSampled = 1;
+      if (SIM_now - SIM_slotStart > 15)
+      {                               // data valid only for 15 µs
+        SIM_violation();
+      }
+      if (SIM_slotNoise)
+      {
+        low = !low;
+      }
+    }
+  }
+  return !low;
+}
+
+/**
+ * @name OW_strongPullup()
+ * @param on - 1 to connect the bus to VDD
+ */
+void OW_strongPullup(uint8_t on)
+{
+  for (int16_t i=0; i<SIM_count; i++)
+  {
+    SIM_device_t *d = &SIM_devices[i];
+    if (on && (d->convEnd > 0))
+    {
+      d->convPowered = 1;
+    }
+  }
+  if (!on)
+  {
+    SIM_parasiteCheck();
+  }
+}
+
+/**
+ * @name SIM_delay()
+ * @param us - time in µs
+ * @brief advances the simulated time, replaces _delay_us()
+ */
+void SIM_delay(double us)
+{
+  SIM_now += us;
+  SIM_stats.busTime += us;
+}
+
+uint8_t SIM_irqOff(void)
+{
+  if (SIM_irqDepth++ == 0)
+  {
+    SIM_irqStart = SIM_now;
+  }
+  return 1;
+}
+
+void SIM_irqOn(uint8_t *dummy)
+{
+  double t;
+
+  (void)dummy;                      // cleanup argument of ATOMIC_BLOCK()
+  if (--SIM_irqDepth == 0)
+  {
+    t = SIM_now - SIM_irqStart;
+    SIM_stats.irqOffTime += t;
+    if (t > SIM_stats.irqOffMax)
+    {
+      SIM_stats.irqOffMax = t;
+    }
+  }
+}
+
+void SIM_clearStats(void)
+{
+  memset(&SIM_stats, 0, sizeof(SIM_stats));
+}
+
+void SIM_clear(void)
+{
+  memset(SIM_devices, 0, sizeof(SIM_devices));
+  SIM_count = 0;
+  SIM_now = 0;
+  SIM_lowStart = -1;
+  SIM_slotStart = -1e9;
+  SIM_prevSlot = -1e9;
+  SIM_presenceStart = SIM_presenceEnd = -1;
+  SIM_clearStats();
+}
+
+int16_t SIM_addDevice(uint64_t rom, int16_t centi, uint8_t parasite)
+{
+  static const uint8_t powerup[9] = {0x50, 0x05, 0x4b, 0x46, 0x7f, 0xff, 0x0c, 0x10, 0x00};
+  SIM_device_t *d;
+
+  if (SIM_count >= SIM_MAX_DEVICES)
+  {
+    return -1;
+  }
+  d = &SIM_devices[SIM_count];
+  memset(d, 0, sizeof(*d));
+  d->rom = rom;
+  d->centi = centi;
+  d->present = 1;
+  d->parasite = parasite;
+  memcpy(d->scratchpad, powerup, 9);
+  d->scratchpad[8] = SIM_crc8(d->scratchpad, 8);
+  memcpy(d->eeprom, &powerup[2], 3);
+  return SIM_count++;
+}
+
+void SIM_removeDevice(int16_t n)
+{
+  SIM_devices[n].present = 0;
+}
+
+void SIM_setTemperature(int16_t n, int16_t centi)
+{
+  SIM_devices[n].centi = centi;
+}
+
+int16_t SIM_deviceRaw(int16_t n)
+{
+  SIM_finish(&SIM_devices[n]);
+  return SIM_devices[n].scratchpad[0] | (SIM_devices[n].scratchpad[1] << 8);
+}
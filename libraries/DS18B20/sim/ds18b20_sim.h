@@ -0,0 +1,114 @@
+/**
+ * @file ds18b20_sim.h
+ * @brief host simulator of a 1-wire bus with virtual DS18B20 devices
+ *
+ * @author Uwe Zimmermann
+ *
+ * The library work is licensed under a MIT license.\n
+ * See https://github.com/uwezi/AVR-Dx
+ *
+ * onewire.c is compiled for the host with -DOW_SIM, its pin functions
+ * OW_set(), OW_release(), OW_get() and OW_strongPullup() are then taken
+ * from ds18b20_sim.c. The headers in
+ * sim/avr and sim/util replace avr-libc: _delay_us() advances the simulated
+ * time and ATOMIC_BLOCK() measures how long the interrupts are disabled.
+ *
+ * The bus is a wired-AND of the master and the virtual devices. The devices
+ * decode reset and time slots from the length of the low pulses of the
+ * master, answer with presence pulses and 0-bits held for SIM_holdTime µs,
+ * and implement the ROM commands (READ, MATCH, SKIP, SEARCH, ALARM SEARCH)
+ * and the DS18B20 function commands with conversion times, scratchpad CRC
+ * and parasite power.
+ *
+ * Timing violations of the master are counted in SIM_stats.violations:
+ * reset pulses shorter than 480 µs, read samples later than 15 µs after the
+ * start of the slot, slots shorter than 60 µs and bus activity during the
+ * conversion of a parasite powered device.
+ *
+ * ChangeLog:
+ * --------
+ * * 2026-10-18 created.
+ * * 2026-10-18 replaces the pin functions of onewire.c
+ */
+
+#ifndef ds18b20_sim_h
+#define ds18b20_sim_h
+
+#include <stdint.h>
+
+#define SIM_MAX_DEVICES 256
+
+/**
+ * @brief adjustable behaviour of the simulated bus
+ */
+extern double SIM_holdTime;     //!< µs a device keeps a 0-bit low, 15..60
+extern double SIM_convFactor;   //!< real conversion time / datasheet maximum
+extern double SIM_noise;        //!< probability of a corrupted read slot
+extern int16_t SIM_tempNoise;   //!< max. random deviation in 1/100 °C
+
+/**
+ * @brief statistics of the simulated master
+ */
+typedef struct
+{
+  double   busTime;      //!< µs of simulated time
+  double   irqOffTime;   //!< µs with disabled interrupts
+  double   irqOffMax;    //!< longest period with disabled interrupts
+  uint32_t resets;
+  uint32_t slots;
+  uint32_t violations;
+} SIM_stats_t;
+
+extern SIM_stats_t SIM_stats;
+
+/**
+ * @name SIM_makeROM()
+ * @param family - family code, 0x28 for the DS18B20
+ * @param serial - 48 bit serial number
+ * @return uint64_t - ROM code with CRC
+ */
+uint64_t SIM_makeROM(uint8_t family, uint64_t serial);
+
+/**
+ * @name SIM_clear()
+ * @brief removes all devices, clears time and statistics
+ */
+void SIM_clear(void);
+
+/**
+ * @name SIM_clearStats()
+ * @brief clears the statistics, e.g. before a measurement
+ */
+void SIM_clearStats(void);
+
+/**
+ * @name SIM_addDevice()
+ * @param rom - ROM code of the device
+ * @param centi - temperature of the device in 1/100 °C
+ * @param parasite - 1 if the device is parasite powered
+ * @return int16_t - number of the device, -1 if the bus is full
+ */
+int16_t SIM_addDevice(uint64_t rom, int16_t centi, uint8_t parasite);
+
+/**
+ * @name SIM_removeDevice()
+ * @param n - number of the device
+ * @brief disconnects a device from the bus
+ */
+void SIM_removeDevice(int16_t n);
+
+/**
+ * @name SIM_setTemperature()
+ * @param n - number of the device
+ * @param centi - new temperature in 1/100 °C
+ */
+void SIM_setTemperature(int16_t n, int16_t centi);
+
+/**
+ * @name SIM_deviceRaw()
+ * @param n - number of the device
+ * @return int16_t - last converted temperature in the scratchpad, 1/16 °C
+ */
+int16_t SIM_deviceRaw(int16_t n);
+
+#endif
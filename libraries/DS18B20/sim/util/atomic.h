@@ -0,0 +1,25 @@
+/**
+ * @file util/atomic.h
+ * @brief host replacement of <util/atomic.h> for the 1-wire simulator
+ *
+ * ATOMIC_BLOCK() keeps the semantics of avr-libc (the block is left through
+ * a cleanup handler, also by return or break) and measures the simulated
+ * time with disabled interrupts.
+ */
+
+#ifndef sim_util_atomic_h
+#define sim_util_atomic_h
+
+#include <stdint.h>
+
+uint8_t SIM_irqOff(void);
+void    SIM_irqOn(uint8_t *dummy);
+
+#define ATOMIC_RESTORESTATE
+#define ATOMIC_FORCEON
+
+#define ATOMIC_BLOCK(type) \
+  for (uint8_t sim_todo __attribute__((__cleanup__(SIM_irqOn))) = SIM_irqOff(); \
+       sim_todo; sim_todo = 0)
+
+#endif
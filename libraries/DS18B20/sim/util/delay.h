@@ -0,0 +1,16 @@
+/**
+ * @file util/delay.h
+ * @brief host replacement of <util/delay.h> for the 1-wire simulator
+ *
+ * The delays advance the simulated time, the code in between takes no time.
+ */
+
+#ifndef sim_util_delay_h
+#define sim_util_delay_h
+
+void SIM_delay(double us);
+
+#define _delay_us(us) SIM_delay(us)
+#define _delay_ms(ms) SIM_delay((ms) * 1000.0)
+
+#endif
@@ -15,6 +15,8 @@
  * - 0x04 read input register - same register block as 0x03
  * - 0x06 write single holding register
  * - 0x16 write multiple holding registers
+ * - 0x14 read file record - served by handlers registered with MODBUS_addFile()
+ * - 0x15 write file record - served by handlers registered with MODBUS_addFile()
  *
  * Uses TCB1, TCB2 and EVSYS.CHANNEL0 for timeout control
  *
@@ -22,6 +24,7 @@
  * ChangeLog:
  * --------
  * * 2025-07-14 created.
+ * * 2026-10-18 added file record access (0x14/0x15)
  */
 
  #include <modbus_rtu.h>
@@ -51,6 +54,21 @@ volatile uint16_t mbBufferPtr = 0;
  */
 #define MODBUS16BIT( BUFFER, INDEX ) ((BUFFER[INDEX]<<8) + BUFFER[INDEX+1])
 
+/**
+ * @brief table of the registered files for 0x14/0x15
+ * @note internal use only
+ */
+const MODBUS_FILE_t *mbFiles[mbMAXFILES];
+uint8_t mbFileCount = 0;
+
+/**
+ * @brief a checked 0x15 request waits in mbBuffer for MODBUS_poll(), the
+ *        reception is paused until the records are written
+ * @note internal use only
+ */
+volatile uint8_t mbWritePending = 0;
+uint16_t mbWriteLength;
+
 /**
  * @brief static CRC table
  * @note borrowed from https://github.com/LacobusVentura/MODBUS-CRC16/
@@ -112,6 +130,21 @@ uint16_t Modbus_CRC16(uint8_t *frame, uint16_t framesize)
     return crc;
 }
 
+/**
+ * @param crc running CRC, start with 0xFFFF
+ * @param c next byte of the message
+ * @return updated CRC
+ * @brief adds one byte to a running CRC16, for messages which are never
+ *        completely stored in the buffer
+ */
+static inline uint16_t Modbus_CRC16_update(uint16_t crc, uint8_t c)
+{
+    uint8_t xor = c ^ crc;
+    crc >>= 8;
+    crc ^= pgm_read_word(&mb_crctable[xor]);
+    return crc;
+}
+
 /**
  * @param none
  * @brief enables and resets the timout timer
@@ -184,6 +217,10 @@ ISR(TCB2_INT_vect)
 ISR(UART_INTVEC)
 {
     uint8_t ch = UART.RXDATAL;
+    if (mbWritePending)
+    {
+        return; // mbBuffer holds the request for MODBUS_poll()
+    }
     MODBUS_Timout_Enable();
 
     mbBuffer[mbBufferPtr] = ch;
@@ -244,6 +281,272 @@ int16_t MODBUS_UART_BlockingSendBuffer(uint16_t count)
     return result;
 }
 
+/**
+ * @param none
+ * @return start value for the running CRC
+ * @brief starts a streamed response which is sent byte by byte while it is
+ *        being generated, see MODBUS_UART_StreamByte()
+ * @note internal use only
+ */
+static uint16_t MODBUS_UART_StreamStart(void)
+{
+    UART.CTRLB = USART_TXEN_bm | USART_ODME_bm;
+    return 0xFFFF;
+}
+
+/**
+ * @param c - byte to send
+ * @param crc - running CRC of the response
+ * @return updated CRC
+ * @brief sends one byte of a streamed response, blocking
+ * @note internal use only
+ */
+static uint16_t MODBUS_UART_StreamByte(uint8_t c, uint16_t crc)
+{
+    MODBUS_UART_BlockingSendByte(c);
+    return Modbus_CRC16_update(crc, c);
+}
+
+/**
+ * @param crc - running CRC of the response
+ * @brief appends the CRC and finishes a streamed response
+ * @note internal use only
+ */
+static void MODBUS_UART_StreamEnd(uint16_t crc)
+{
+    MODBUS_UART_BlockingSendByte(crc % 256);
+    MODBUS_UART_BlockingSendByte(crc / 256);
+    while (!(UART.STATUS & USART_TXCIF_bm));
+    UART.STATUS = USART_TXCIF_bm;
+    UART.CTRLB = USART_TXEN_bm | USART_RXEN_bm | USART_ODME_bm;
+}
+
+/**
+ * @param code - MODBUS exception code
+ * @brief sends an exception response for the function in mbBuffer[1]
+ * @note internal use only
+ */
+static void MODBUS_SendException(uint8_t code)
+{
+    uint16_t crc;
+    mbBuffer[1] |= 0x80;
+    mbBuffer[2] = code;
+    crc = Modbus_CRC16(mbBuffer, 3);
+    mbBuffer[3] = crc % 256;
+    mbBuffer[4] = crc / 256;
+    MODBUS_UART_BlockingSendBuffer(5);
+}
+
+/**
+ * @param file pointer to the file description, must stay valid
+ * @return 0 on success, 1 if the file table is full
+ * @brief registers a file for the 0x14/0x15 file record functions
+ */
+uint8_t MODBUS_addFile(const MODBUS_FILE_t *file)
+{
+    if (mbFileCount >= mbMAXFILES)
+    {
+        return 1;
+    }
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        mbFiles[mbFileCount++] = file;
+    }
+    return 0;
+}
+
+/**
+ * @param number - MODBUS file number
+ * @param start - first record
+ * @param count - number of records
+ * @return pointer to the file, NULL if the file or the records do not exist
+ * @brief looks up a registered file and checks the record range
+ * @note internal use only
+ */
+static const MODBUS_FILE_t *MODBUS_findFile(uint16_t number, uint16_t start, uint16_t count)
+{
+    for (uint8_t i = 0; i < mbFileCount; i++)
+    {
+        if (mbFiles[i]->number == number)
+        {
+            if ((start > mbMAXRECORD) || ((uint32_t)start + count > mbFiles[i]->length))
+            {
+                return NULL;
+            }
+            return mbFiles[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief stock handlers for a file in RAM, file->data points to a uint16_t array
+ */
+uint16_t MODBUS_fileReadRAM(const MODBUS_FILE_t *file, uint16_t record)
+{
+    return ((uint16_t *)file->data)[record];
+}
+
+void MODBUS_fileWriteRAM(const MODBUS_FILE_t *file, uint16_t record, uint16_t value)
+{
+    ((uint16_t *)file->data)[record] = value;
+}
+
+/**
+ * @brief stock handlers for a file in EEPROM, file->data is the EEPROM address
+ */
+uint16_t MODBUS_fileReadEEPROM(const MODBUS_FILE_t *file, uint16_t record)
+{
+    return eeprom_read_word((const uint16_t *)file->data + record);
+}
+
+void MODBUS_fileWriteEEPROM(const MODBUS_FILE_t *file, uint16_t record, uint16_t value)
+{
+    eeprom_update_word((uint16_t *)file->data + record, value);
+}
+
+/**
+ * @brief stock read handler for a constant table in flash
+ */
+uint16_t MODBUS_fileReadFlash(const MODBUS_FILE_t *file, uint16_t record)
+{
+    return pgm_read_word((const uint16_t *)file->data + record);
+}
+
+/**
+ * @param none
+ * @brief 0x14 read file record - checks all sub-requests, then streams the
+ *        records from the file handlers directly to the UART
+ * @note internal use only
+ */
+static void MODBUS_ReadFileRecord(void)
+{
+    uint8_t bytecount = mbBuffer[2];
+    uint32_t resplen = 0;
+    uint16_t crc;
+    uint8_t i;
+
+    if ((bytecount < 7) || (bytecount > 0xF5) || (bytecount % 7) || (mbBufferPtr != bytecount + 5))
+    {
+        MODBUS_SendException(0x03); // illegal data value
+        return;
+    }
+    // validate everything before the first byte of the response goes out
+    for (i = 3; i < bytecount + 3; i += 7)
+    {
+        if ((mbBuffer[i] != 6) ||
+            (MODBUS_findFile(MODBUS16BIT(mbBuffer, i + 1), MODBUS16BIT(mbBuffer, i + 3), MODBUS16BIT(mbBuffer, i + 5)) == NULL))
+        {
+            MODBUS_SendException(0x02); // illegal data address
+            return;
+        }
+        resplen += 2 + 2 * MODBUS16BIT(mbBuffer, i + 5);
+    }
+    if (resplen > 0xF5)
+    {
+        MODBUS_SendException(0x03); // response would not fit into one frame
+        return;
+    }
+
+    crc = MODBUS_UART_StreamStart();
+    crc = MODBUS_UART_StreamByte(mbBuffer[0], crc);
+    crc = MODBUS_UART_StreamByte(mbBuffer[1], crc);
+    crc = MODBUS_UART_StreamByte(resplen, crc);
+    for (i = 3; i < bytecount + 3; i += 7)
+    {
+        uint16_t start = MODBUS16BIT(mbBuffer, i + 3);
+        uint16_t count = MODBUS16BIT(mbBuffer, i + 5);
+        const MODBUS_FILE_t *file = MODBUS_findFile(MODBUS16BIT(mbBuffer, i + 1), start, count);
+        crc = MODBUS_UART_StreamByte(1 + 2 * count, crc);
+        crc = MODBUS_UART_StreamByte(6, crc);
+        while (count--)
+        {
+            uint16_t value = file->read(file, start++);
+            crc = MODBUS_UART_StreamByte(value / 256, crc);
+            crc = MODBUS_UART_StreamByte(value % 256, crc);
+        }
+    }
+    MODBUS_UART_StreamEnd(crc);
+}
+
+/**
+ * @param none
+ * @brief 0x15 write file record - checks all sub-requests and leaves the
+ *        request to MODBUS_poll(), the file handlers (EEPROM!) are too slow
+ *        for the interrupt
+ * @note internal use only
+ */
+static void MODBUS_WriteFileRecord(void)
+{
+    uint8_t bytecount = mbBuffer[2];
+    uint16_t i, count;
+    const MODBUS_FILE_t *file;
+
+    if ((bytecount < 9) || (bytecount > 0xFB) || (mbBufferPtr != bytecount + 5))
+    {
+        MODBUS_SendException(0x03); // illegal data value
+        return;
+    }
+    // first pass: check all sub-requests, nothing is written on errors
+    for (i = 3; i < bytecount + 3; i += 7 + 2 * count)
+    {
+        if ((i + 7 > bytecount + 3) || (mbBuffer[i] != 6))
+        {
+            MODBUS_SendException(0x03); // illegal data value
+            return;
+        }
+        count = MODBUS16BIT(mbBuffer, i + 5);
+        if ((count > 122) || (i + 7 + 2 * count > bytecount + 3))
+        {
+            MODBUS_SendException(0x03); // illegal data value
+            return;
+        }
+        file = MODBUS_findFile(MODBUS16BIT(mbBuffer, i + 1), MODBUS16BIT(mbBuffer, i + 3), count);
+        if ((file == NULL) || (file->write == NULL))
+        {
+            MODBUS_SendException(0x02); // illegal data address
+            return;
+        }
+    }
+    mbWriteLength = mbBufferPtr;
+    mbWritePending = 1;
+}
+
+/**
+ * @param none
+ * @return 1 if a 0x15 request was written, 0 if none was pending
+ * @brief writes the records of a pending 0x15 write file record request
+ *        through the file handlers and echoes the request
+ * @note call from the main loop, runs with enabled interrupts; an EEPROM
+ *       record takes up to 2 erase/write cycles of the EEPROM
+ */
+uint8_t MODBUS_poll(void)
+{
+    uint8_t bytecount;
+    uint16_t i, count;
+    const MODBUS_FILE_t *file;
+
+    if (!mbWritePending)
+    {
+        return 0;
+    }
+    bytecount = mbBuffer[2];
+    for (i = 3; i < bytecount + 3; i += 7 + 2 * count)
+    {
+        uint16_t start = MODBUS16BIT(mbBuffer, i + 3);
+        count = MODBUS16BIT(mbBuffer, i + 5);
+        file = MODBUS_findFile(MODBUS16BIT(mbBuffer, i + 1), start, count);
+        for (uint16_t j = 0; j < count; j++)
+        {
+            file->write(file, start + j, MODBUS16BIT(mbBuffer, i + 7 + 2 * j));
+        }
+    }
+    // echo message back
+    MODBUS_UART_BlockingSendBuffer(mbWriteLength);
+    mbWritePending = 0;
+    return 1;
+}
+
 /**
  * @param address Modbus/RTU address, 1..255
  * @return none
@@ -364,6 +667,12 @@ void MODBUS_decode(void)
                 mbBuffer[7] = crc / 256;
                 MODBUS_UART_BlockingSendBuffer(8);
                 break;
+            case 20: // read file record
+                MODBUS_ReadFileRecord();
+                break;
+            case 21: // write file record
+                MODBUS_WriteFileRecord();
+                break;
             default:
                 break;
             }
@@ -15,6 +15,9 @@
  * - 0x04 read input register - same register block as 0x03
  * - 0x06 write single holding register
  * - 0x16 write multiple holding registers
+ * - 0x14 read file record - served by handlers registered with MODBUS_addFile()
+ * - 0x15 write file record - served by handlers registered with MODBUS_addFile()
+ *   and written by MODBUS_poll()
  *
  * Uses TCB1, TCB2 and EVSYS.CHANNEL0 for timeout control
  *
@@ -22,6 +25,7 @@
  * ChangeLog:
  * --------
  * * 2025-07-14 created.
+ * * 2026-10-18 added file record access (0x14/0x15)
  */
 
 #ifndef modbus_rtu_h
@@ -32,6 +36,7 @@
 #include <avr/pgmspace.h>
 #include <avr/interrupt.h>
 #include <util/atomic.h>
+#include <avr/eeprom.h>
 
 /**
  * @brief hardware parameters of the UART module to be used
@@ -61,6 +66,63 @@ extern volatile uint16_t mbHolding[mbHOLDINGSIZE+1];
 **/
 extern volatile uint8_t mbAdress;
 
+/**
+ * @brief maximum number of files which can be registered for 0x14/0x15
+**/
+#define mbMAXFILES 4
+
+/**
+ * @brief largest record number allowed by the MODBUS specification
+**/
+#define mbMAXRECORD 9999
+
+/**
+ * @brief handler for one MODBUS file, accessed with 0x14/0x15
+ * @note a file is a linear array of 16-bit records (registers), the handler
+ *       functions are called once per record while the response is being
+ *       transmitted, so the data never has to be copied into mbBuffer
+**/
+typedef struct MODBUS_FILE_s MODBUS_FILE_t;
+struct MODBUS_FILE_s
+{
+    uint16_t number;    //!< MODBUS file number 1..65535
+    uint16_t length;    //!< number of records in the file, max. mbMAXRECORD+1
+    uint16_t (*read)(const MODBUS_FILE_t *file, uint16_t record);                 //!< returns one record
+    void     (*write)(const MODBUS_FILE_t *file, uint16_t record, uint16_t value); //!< stores one record, NULL if read-only
+    void     *data;     //!< backing store, used by the handlers below
+};
+
+/**
+ * \name
+ * @param file pointer to the file description, must stay valid
+ * @return 0 on success, 1 if the file table is full
+ * @brief registers a file for the 0x14/0x15 file record functions
+ */
+uint8_t MODBUS_addFile(const MODBUS_FILE_t *file);
+
+/**
+ * \name
+ * @brief stock handlers for a file in RAM, file->data points to a uint16_t array
+ */
+uint16_t MODBUS_fileReadRAM(const MODBUS_FILE_t *file, uint16_t record);
+void MODBUS_fileWriteRAM(const MODBUS_FILE_t *file, uint16_t record, uint16_t value);
+
+/**
+ * \name
+ * @brief stock handlers for a file in EEPROM, file->data is the EEPROM address
+ * @note every changed byte takes one erase/write cycle of the EEPROM (ms),
+ *       a 0x15 request with 122 records can take seconds
+ */
+uint16_t MODBUS_fileReadEEPROM(const MODBUS_FILE_t *file, uint16_t record);
+void MODBUS_fileWriteEEPROM(const MODBUS_FILE_t *file, uint16_t record, uint16_t value);
+
+/**
+ * \name
+ * @brief stock read handler for a constant table in flash, file->data points
+ *        to a uint16_t array in PROGMEM (read-only, set write to NULL)
+ */
+uint16_t MODBUS_fileReadFlash(const MODBUS_FILE_t *file, uint16_t record);
+
 /**
  * \name
  * @param address Modbus/RTU address, 1..255
@@ -68,5 +130,15 @@ extern volatile uint8_t mbAdress;
  * @brief initialize the Modbus/RTU server
  */
 void MODBUS_init(uint8_t address);
+/**
+ * \name
+ * @param none
+ * @return 1 if a 0x15 request was written, 0 if none was pending
+ * @brief writes the records of a pending 0x15 write file record request
+ *        through the file handlers and echoes the request
+ * @note call from the main loop if files with a write handler are
+ *       registered; the reception is paused until then
+ */
+uint8_t MODBUS_poll(void);
 
-#endif
\ No newline at end of file
+#endif
\ No newline at end of file
@@ -1,30 +1,57 @@
+/*
+ * example for the SPI0 transport, the whole project (library and example)
+ * is compiled with -DNOKIA_TRANSPORT=NOKIA_TRANSPORT_SPI;
+ * RST on PA2 and DC on PA3 are the defaults of nokia5110.h
+ */
 #include <avr/io.h>
 #include <util/delay.h>
 #include <stdio.h>
-#include <nokia5110_hspi.h>
+#include <nokia5110.h>
+#include <nokia5110_gfx.h>
 
 void plotduty(uint8_t x0, uint8_t y0, uint8_t duty)
 {
   duty = duty/4;
-  for (uint8_t i = 0; i < 10; i++)
+  NOKIA_vline(x0-1, y0-9, y0, NOKIA_DRAW_SET);
+  NOKIA_vline(x0+64, y0-9, y0, NOKIA_DRAW_SET);
+  NOKIA_vline(x0+duty, y0-9, y0, NOKIA_DRAW_SET);
+  if (duty > 0)
   {
-    NOKIA_setpixel(x0-1,y0-i);
-    NOKIA_setpixel(x0+64,y0-i);
-    NOKIA_setpixel(x0+duty,y0-i);
+    NOKIA_hline(x0, x0+duty-1, y0-10, NOKIA_DRAW_SET);
   }
-
-  for (uint8_t i = 0; i < 64; i++)
+  if (duty < 64)
   {
-    if (i < duty)
-    {
-      NOKIA_setpixel(x0+i,y0-10);
-    }
-    else
-    {
-      NOKIA_setpixel(x0+i,y0);
-    }
+    NOKIA_hline(x0+duty, x0+63, y0, NOKIA_DRAW_SET);
   }
+}
 
+/**
+ * measures a full update of the display with TCB0 and shows the utilisation
+ * of the SPI: 504 data and 12 command bytes need 516*8 SPI clocks of 4 CPU
+ * cycles each
+ */
+void benchmark(void)
+{
+  char textbuffer[20];
+  uint16_t cycles;
+  uint32_t ideal = (uint32_t)(NOKIA_SIZEX*NOKIA_BANKS + 2*NOKIA_BANKS) * 8 * 4;
+
+  NOKIA_markdirty(0, NOKIA_SIZEX-1, 0, NOKIA_SIZEY-1);
+  TCB0.CCMP = 0xffff;
+  TCB0.CNT = 0;
+  TCB0.CTRLB = TCB_CNTMODE_INT_gc;
+  TCB0.CTRLA = TCB_CLKSEL_DIV1_gc | TCB_ENABLE_bm;
+  NOKIA_update();
+  while ((NOKIA_SPI.INTFLAGS & SPI_TXCIF_bm) == 0) {}  // until the last bit
+  cycles = TCB0.CNT;
+  TCB0.CTRLA = 0;
+
+  sprintf(textbuffer, "%5u cycles", cycles);
+  NOKIA_print(0,24,textbuffer,NOKIA_NORMAL);
+  sprintf(textbuffer, "SPI %3u%%", (uint16_t)(100*ideal/cycles));
+  NOKIA_print(0,32,textbuffer,NOKIA_NORMAL);
+  NOKIA_update();
+  _delay_ms(2000);
 }
 
 int main(void)
@@ -39,9 +66,6 @@ int main(void)
 
 
   NOKIA_init(
-    &SPI0,
-    &PORTA, 2, //rst_pin,
-    &PORTA, 3, //dc_pin,
     0xc0, //vop,
    NOKIA_ORIENTATION_180
 
@@ -57,6 +81,8 @@ int main(void)
 
   NOKIA_update();
 
+  benchmark();
+
   VREF.ADC0REF = VREF_REFSEL_VDD_gc;
   PORTD.PIN0CTRL = PORT_ISC_INPUT_DISABLE_gc ;
   PORTD.PIN1CTRL = PORT_ISC_INPUT_DISABLE_gc ;
@@ -77,10 +103,13 @@ int main(void)
   PORTMUX.TCAROUTEA = PORTMUX_TCA0_PORTA_gc;
 
   uint16_t adc0,adc1;
+  uint16_t last0=0xffff, last1=0xffff;
+
+  NOKIA_clearbuffer();              // once, the loop only overwrites what changes
+  sei();
   while (1)
   {
-    NOKIA_clearbuffer();
-
+    // the ADC runs while the previous frame is sent in the background
     ADC0.MUXPOS = ADC_MUXPOS_AIN0_gc;
     ADC0.COMMAND = ADC_STCONV_bm;
     while (ADC0_COMMAND & ADC_STCONV_bm) {}
@@ -91,16 +120,26 @@ int main(void)
     while (ADC0_COMMAND & ADC_STCONV_bm) {}
     adc1 = ADC0.RES / 16;
 
+    while (NOKIA_busy) {}
+    if ((adc0 == last0) && (adc1 == last1))
+    {
+      continue;                     // nothing to send
+    }
+
     sprintf(textbuffer,"ch1 %3d  ch2 %3d",adc0,adc1);
     NOKIA_printtiny(0,42,textbuffer,NOKIA_NORMAL);
 
     TCA0.SINGLE.CMP0 = adc0;
     TCA0.SINGLE.CTRLA = TCA_SINGLE_ENABLE_bm | ((adc1/32)<<1);
 
-    sprintf(textbuffer,"d/c =   %3d %%",(adc0*100)/255);
-    NOKIA_print(0,12,textbuffer,NOKIA_NORMAL);
+    if (adc0 != last0)
+    {
+      sprintf(textbuffer,"d/c =   %3d %%",(adc0*100)/255);
+      NOKIA_print(0,12,textbuffer,NOKIA_NORMAL);
 
-    plotduty(8,34,adc0);
+      NOKIA_fillrect(7,24,72,34,NOKIA_DRAW_CLEAR);
+      plotduty(8,34,adc0);
+    }
 
     switch ((TCA0.SINGLE.CTRLA>>1) & 0b00000111)
     {
@@ -135,7 +174,9 @@ int main(void)
     }
     sprintf(textbuffer, "  f = %5d Hz",f);
     NOKIA_print(0,2,textbuffer,NOKIA_NORMAL);
-    NOKIA_update();
+    last0 = adc0;
+    last1 = adc1;
+    NOKIA_updateAsync(NULL);
 
   }
 
@@ -0,0 +1,184 @@
+/*
+ * example for the USART1 transport, the whole project (library and example)
+ * is compiled with -DNOKIA_TRANSPORT=NOKIA_TRANSPORT_USART;
+ * RST on PA2 and DC on PA3 are the defaults of nokia5110.h
+ */
+#include <avr/io.h>
+#include <util/delay.h>
+#include <stdio.h>
+#include <nokia5110.h>
+#include <nokia5110_gfx.h>
+
+void plotduty(uint8_t x0, uint8_t y0, uint8_t duty)
+{
+  duty = duty/4;
+  NOKIA_vline(x0-1, y0-9, y0, NOKIA_DRAW_SET);
+  NOKIA_vline(x0+64, y0-9, y0, NOKIA_DRAW_SET);
+  NOKIA_vline(x0+duty, y0-9, y0, NOKIA_DRAW_SET);
+  if (duty > 0)
+  {
+    NOKIA_hline(x0, x0+duty-1, y0-10, NOKIA_DRAW_SET);
+  }
+  if (duty < 64)
+  {
+    NOKIA_hline(x0+duty, x0+63, y0, NOKIA_DRAW_SET);
+  }
+}
+
+/**
+ * measures a full update of the display with TCB0 and shows the utilisation
+ * of the USART: 504 data and 12 command bytes need 516*8 SPI clocks of
+ * 2*NOKIA_USPI_DIV CPU cycles each
+ */
+void benchmark(void)
+{
+  char textbuffer[20];
+  uint16_t cycles;
+  uint32_t ideal = (uint32_t)(NOKIA_SIZEX*NOKIA_BANKS + 2*NOKIA_BANKS) * 8 * 2 * NOKIA_USPI_DIV;
+
+  NOKIA_markdirty(0, NOKIA_SIZEX-1, 0, NOKIA_SIZEY-1);
+  TCB0.CCMP = 0xffff;
+  TCB0.CNT = 0;
+  TCB0.CTRLB = TCB_CNTMODE_INT_gc;
+  TCB0.CTRLA = TCB_CLKSEL_DIV1_gc | TCB_ENABLE_bm;
+  NOKIA_update();
+  while ((NOKIA_USART.STATUS & USART_TXCIF_bm) == 0) {}  // until the last bit
+  cycles = TCB0.CNT;
+  TCB0.CTRLA = 0;
+
+  sprintf(textbuffer, "%5u cycles", cycles);
+  NOKIA_print(0,24,textbuffer,NOKIA_NORMAL);
+  sprintf(textbuffer, "USART %3u%%", (uint16_t)(100*ideal/cycles));
+  NOKIA_print(0,32,textbuffer,NOKIA_NORMAL);
+  NOKIA_update();
+  _delay_ms(2000);
+}
+
+int main(void)
+{
+  _delay_ms(1000);
+  PORTA.DIRSET = PIN0_bm | PIN2_bm | PIN3_bm | PIN4_bm | PIN6_bm;
+  uint16_t f=0;
+  uint8_t vop=0;
+  char textbuffer[40];
+
+  PORTMUX.USARTROUTEA = PORTMUX_USART1_DEFAULT_gc;
+  PORTC.DIRSET = PIN0_bm | PIN2_bm;   // TXD1 and XCK1
+
+
+  NOKIA_init(
+    0xc0, //vop,
+   NOKIA_ORIENTATION_180
+
+  );
+
+  NOKIA_update();
+
+  _delay_ms(1000);
+
+  NOKIA_clear();
+
+  NOKIA_print(0,40,"Hello World!",NOKIA_NORMAL);
+
+  NOKIA_update();
+
+  benchmark();
+
+  VREF.ADC0REF = VREF_REFSEL_VDD_gc;
+  PORTD.PIN0CTRL = PORT_ISC_INPUT_DISABLE_gc ;
+  PORTD.PIN1CTRL = PORT_ISC_INPUT_DISABLE_gc ;
+  ADC0.CTRLA = (0 << ADC_CONVMODE_bp )
+             | ADC_RESSEL_12BIT_gc
+             | ADC_ENABLE_bm ;
+  ADC0.CTRLB = 0;
+  ADC0.CTRLC = ADC_PRESC_DIV20_gc;
+  ADC0.CTRLD = 0;
+  ADC0.CTRLE = 0;
+  ADC0.SAMPCTRL = 0;
+  ADC0.MUXPOS = ADC_MUXPOS_AIN0_gc;
+  ADC0.MUXNEG = ADC_MUXNEG_GND_gc;
+
+  TCA0.SINGLE.CTRLA = TCA_SINGLE_ENABLE_bm | TCA_SINGLE_CLKSEL_DIV1_gc;
+  TCA0.SINGLE.CTRLB = TCA_SINGLE_CMP0EN_bm | TCA_SINGLE_WGMODE_SINGLESLOPE_gc;
+  TCA0.SINGLE.PER = 255;
+  PORTMUX.TCAROUTEA = PORTMUX_TCA0_PORTA_gc;
+
+  uint16_t adc0,adc1;
+  uint16_t last0=0xffff, last1=0xffff;
+
+  NOKIA_clearbuffer();              // once, the loop only overwrites what changes
+  sei();
+  while (1)
+  {
+    // the ADC runs while the previous frame is sent in the background
+    ADC0.MUXPOS = ADC_MUXPOS_AIN0_gc;
+    ADC0.COMMAND = ADC_STCONV_bm;
+    while (ADC0_COMMAND & ADC_STCONV_bm) {}
+    adc0 = ADC0.RES / 16;
+
+    ADC0.MUXPOS = ADC_MUXPOS_AIN1_gc;
+    ADC0.COMMAND = ADC_STCONV_bm;
+    while (ADC0_COMMAND & ADC_STCONV_bm) {}
+    adc1 = ADC0.RES / 16;
+
+    while (NOKIA_busy) {}
+    if ((adc0 == last0) && (adc1 == last1))
+    {
+      continue;                     // nothing to send
+    }
+
+    sprintf(textbuffer,"ch1 %3d  ch2 %3d",adc0,adc1);
+    NOKIA_printtiny(0,42,textbuffer,NOKIA_NORMAL);
+
+    TCA0.SINGLE.CMP0 = adc0;
+    TCA0.SINGLE.CTRLA = TCA_SINGLE_ENABLE_bm | ((adc1/32)<<1);
+
+    if (adc0 != last0)
+    {
+      sprintf(textbuffer,"d/c =   %3d %%",(adc0*100)/255);
+      NOKIA_print(0,12,textbuffer,NOKIA_NORMAL);
+
+      NOKIA_fillrect(7,24,72,34,NOKIA_DRAW_CLEAR);
+      plotduty(8,34,adc0);
+    }
+
+    switch ((TCA0.SINGLE.CTRLA>>1) & 0b00000111)
+    {
+    case 0:
+      f =  15625;
+      break;
+    case 1:
+      f =   7812;
+      break;
+    case 2:
+      f =   3906;
+      break;
+    case 3:
+      f =   1953;
+      break;
+    case 4:
+      f =    976;
+      break;
+    case 5:
+      f =    244;
+      break;
+    case 6:
+      f =     61;
+      break;
+    case 7:
+      f =     15;
+      break;
+
+    default:
+      f=0;
+      break;
+    }
+    sprintf(textbuffer, "  f = %5d Hz",f);
+    NOKIA_print(0,2,textbuffer,NOKIA_NORMAL);
+    last0 = adc0;
+    last1 = adc1;
+    NOKIA_updateAsync(NULL);
+
+  }
+
+}
@@ -11,106 +11,107 @@
  * --------
  * * 2015-06-09 originally created
  * * 2025-1020 ported to .h file
+ * * 2026-10-18 one byte per column, LSB top row, as the 6x8 font
  */
 #ifndef FONT_4x6_H_
 #define FONT_4x6_H_
 
-static const uint8_t tinyFont[][3] PROGMEM =
-{ // 4x6 font - one nibble per row
-  {0x00, 0x00, 0x00}, // 0x00
-  {0x00, 0x00, 0x00}, // 0x01
-  {0x00, 0x00, 0x00}, // 0x02
-  {0x00, 0x00, 0x00}, // 0x03
-  {0x00, 0x00, 0x00}, // 0x04
-  {0x00, 0x00, 0x00}, // 0x05
-  {0x00, 0x00, 0x00}, // 0x06
-  {0x00, 0x00, 0x00}, // 0x07 arrow up
-  {0x00, 0x00, 0x00}, // 0x08 arrow down
-  {0x00, 0x00, 0x00}, // 0x09 arrow right
-  {0x00, 0x00, 0x00}, // 0x0a arrow left
-  {0x12, 0x70, 0x70}, // 0x0b &le;
-  {0x42, 0x70, 0x70}, // 0x0c &ge;
-  {0x01, 0x57, 0x00}, // 0x0d Delta
-  {0x00, 0x00, 0x00}, // 0x0e Sigma
-  {0x35, 0x62, 0x70}, // 0x0f Omega
-  {0x70, 0x00, 0x00}, // 0x10 bar 1-1
-  {0x77, 0x00, 0x00}, // 0x11 bar 1-2
-  {0x77, 0x70, 0x00}, // 0x12 bar 1-3
-  {0x77, 0x77, 0x00}, // 0x13 bar 1-4
-  {0x77, 0x77, 0x70}, // 0x14 bar 1-5
-  {0x77, 0x77, 0x77}, // 0x15 bar 1-6
-  {0x07, 0x77, 0x77}, // 0x16 bar 2-6
-  {0x00, 0x77, 0x77}, // 0x17 bar 3-6
-  {0x00, 0x07, 0x77}, // 0x18 bar 5-6
-  {0x00, 0x00, 0x77}, // 0x19 bar 5-6
-  {0x00, 0x00, 0x07}, // 0x1a bar 6-6
-  {0x00, 0x00, 0x00}, // 0x1b sound
-  {0x22, 0x27, 0x20}, // 0x1c down
-  {0x01, 0x71, 0x00}, // 0x1d right
-  {0x04, 0x74, 0x00}, // 0x1e left
-  {0x27, 0x22, 0x20}, // 0x1f up
-  {0x00, 0x00, 0x00}, // 0x20 sp
-  {0x22, 0x20, 0x20}, // 0x21 !
-  {0x55, 0x00, 0x00}, // 0x22 "
-  {0x57, 0x57, 0x50}, // 0x23 #
-  {0x00, 0x00, 0x00}, // 0x24 $
-  {0x41, 0x24, 0x10}, // 0x25 %
-  {0x00, 0x00, 0x00}, // 0x26 &
-  {0x22, 0x00, 0x00}, // 0x27 '
-  {0x12, 0x22, 0x10}, // 0x28 (
-  {0x42, 0x22, 0x40}, // 0x29 )
-  {0x05, 0x25, 0x00}, // 0x2a *
-  {0x02, 0x72, 0x00}, // 0x2b +
-  {0x00, 0x02, 0x40}, // 0x2c ,
-  {0x00, 0x70, 0x00}, // 0x2d -
-  {0x00, 0x60, 0x60, 0x00, 0x00, 0x00}, // 0x2e .
-  {0x11, 0x24, 0x40}, // 0x2f /
-  {0x25, 0x55, 0x20}, // 0x30 0
-  {0x26, 0x22, 0x70}, // 0x31 1
-  {0x61, 0x24, 0x70}, // 0x32 2
-  {0x61, 0x21, 0x60}, // 0x33 3
-  {0x45, 0x71, 0x10}, // 0x34 4
-  {0x74, 0x61, 0x60}, // 0x35 5
-  {0x34, 0x75, 0x70}, // 0x36 6
-  {0x71, 0x24, 0x40}, // 0x37 7
-  {0x75, 0x75, 0x70}, // 0x38 8
-  {0x75, 0x71, 0x60}, // 0x39 9
-  {0x02, 0x02, 0x00}, // 0x3a :
-  {0x02, 0x02, 0x40}, // 0x3b ;
-  {0x12, 0x42, 0x10}, // 0x3c <
-  {0x07, 0x07, 0x00}, // 0x3d =
-  {0x42, 0x12, 0x40}, // 0x3e >
-  {0x61, 0x20, 0x10}, // 0x3f ?
-  {0x00, 0x00, 0x00}, // 0x40 @
-  {0x25, 0x75, 0x50}, // 0x41 A
-  {0x65, 0x65, 0x60}, // 0x42 B
-  {0x34, 0x44, 0x30}, // 0x43 C
-  {0x65, 0x55, 0x60}, // 0x44 D
-  {0x74, 0x64, 0x70}, // 0x45 E
-  {0x74, 0x64, 0x40}, // 0x46 F
-  {0x34, 0x55, 0x30}, // 0x47 G
-  {0x55, 0x75, 0x50}, // 0x48 H
-  {0x72, 0x22, 0x70}, // 0x49 I
-  {0x11, 0x15, 0x70}, // 0x4a J
-  {0x55, 0x65, 0x50}, // 0x4b K
-  {0x44, 0x44, 0x70}, // 0x4c L
-  {0x57, 0x75, 0x50}, // 0x4d M
-  {0x65, 0x55, 0x50}, // 0x4e N
-  {0x75, 0x55, 0x70}, // 0x4f O
-  {0x65, 0x64, 0x40}, // 0x50 P
-  {0x75, 0x57, 0x30}, // 0x51 Q
-  {0x65, 0x65, 0x50}, // 0x52 R
-  {0x34, 0x21, 0x60}, // 0x53 S
-  {0x72, 0x22, 0x20}, // 0x54 T
-  {0x55, 0x55, 0x70}, // 0x55 U
-  {0x55, 0x55, 0x20}, // 0x56 V
-  {0x55, 0x57, 0x50}, // 0x57 W
-  {0x55, 0x25, 0x50}, // 0x58 X
-  {0x55, 0x22, 0x20}, // 0x59 Y
-  {0x71, 0x24, 0x70}, // 0x5a Z
-  {0x74, 0x44, 0x70}, // 0x5b [
-  {0x44, 0x21, 0x10}, // 0x5c backslash
-  {0x71, 0x11, 0x70}, // 0x5d ]
+static const uint8_t tinyFont[][4] PROGMEM =
+{ // 4x6 font - one byte per column, bit 0 is the top row
+  {0x00, 0x00, 0x00, 0x00}, // 0x00
+  {0x00, 0x00, 0x00, 0x00}, // 0x01
+  {0x00, 0x00, 0x00, 0x00}, // 0x02
+  {0x00, 0x00, 0x00, 0x00}, // 0x03
+  {0x00, 0x00, 0x00, 0x00}, // 0x04
+  {0x00, 0x00, 0x00, 0x00}, // 0x05
+  {0x00, 0x00, 0x00, 0x00}, // 0x06
+  {0x00, 0x00, 0x00, 0x00}, // 0x07 arrow up
+  {0x00, 0x00, 0x00, 0x00}, // 0x08 arrow down
+  {0x00, 0x00, 0x00, 0x00}, // 0x09 arrow right
+  {0x00, 0x00, 0x00, 0x00}, // 0x0a arrow left
+  {0x00, 0x14, 0x16, 0x15}, // 0x0b &le;
+  {0x00, 0x15, 0x16, 0x14}, // 0x0c &ge;
+  {0x00, 0x0c, 0x08, 0x0e}, // 0x0d Delta
+  {0x00, 0x00, 0x00, 0x00}, // 0x0e Sigma
+  {0x00, 0x16, 0x1d, 0x13}, // 0x0f Omega
+  {0x00, 0x01, 0x01, 0x01}, // 0x10 bar 1-1
+  {0x00, 0x03, 0x03, 0x03}, // 0x11 bar 1-2
+  {0x00, 0x07, 0x07, 0x07}, // 0x12 bar 1-3
+  {0x00, 0x0f, 0x0f, 0x0f}, // 0x13 bar 1-4
+  {0x00, 0x1f, 0x1f, 0x1f}, // 0x14 bar 1-5
+  {0x00, 0x3f, 0x3f, 0x3f}, // 0x15 bar 1-6
+  {0x00, 0x3e, 0x3e, 0x3e}, // 0x16 bar 2-6
+  {0x00, 0x3c, 0x3c, 0x3c}, // 0x17 bar 3-6
+  {0x00, 0x38, 0x38, 0x38}, // 0x18 bar 5-6
+  {0x00, 0x30, 0x30, 0x30}, // 0x19 bar 5-6
+  {0x00, 0x20, 0x20, 0x20}, // 0x1a bar 6-6
+  {0x00, 0x00, 0x00, 0x00}, // 0x1b sound
+  {0x00, 0x08, 0x1f, 0x08}, // 0x1c down
+  {0x00, 0x04, 0x04, 0x0e}, // 0x1d right
+  {0x00, 0x0e, 0x04, 0x04}, // 0x1e left
+  {0x00, 0x02, 0x1f, 0x02}, // 0x1f up
+  {0x00, 0x00, 0x00, 0x00}, // 0x20 sp
+  {0x00, 0x00, 0x17, 0x00}, // 0x21 !
+  {0x00, 0x03, 0x00, 0x03}, // 0x22 "
+  {0x00, 0x1f, 0x0a, 0x1f}, // 0x23 #
+  {0x00, 0x00, 0x00, 0x00}, // 0x24 $
+  {0x00, 0x09, 0x04, 0x12}, // 0x25 %
+  {0x00, 0x00, 0x00, 0x00}, // 0x26 &
+  {0x00, 0x00, 0x03, 0x00}, // 0x27 '
+  {0x00, 0x00, 0x0e, 0x11}, // 0x28 (
+  {0x00, 0x11, 0x0e, 0x00}, // 0x29 )
+  {0x00, 0x0a, 0x04, 0x0a}, // 0x2a *
+  {0x00, 0x04, 0x0e, 0x04}, // 0x2b +
+  {0x00, 0x10, 0x08, 0x00}, // 0x2c ,
+  {0x00, 0x04, 0x04, 0x04}, // 0x2d -
+  {0x00, 0x00, 0x08, 0x00}, // 0x2e .
+  {0x00, 0x18, 0x04, 0x03}, // 0x2f /
+  {0x00, 0x0e, 0x11, 0x0e}, // 0x30 0
+  {0x00, 0x12, 0x1f, 0x10}, // 0x31 1
+  {0x00, 0x19, 0x15, 0x12}, // 0x32 2
+  {0x00, 0x11, 0x15, 0x0a}, // 0x33 3
+  {0x00, 0x07, 0x04, 0x1e}, // 0x34 4
+  {0x00, 0x17, 0x15, 0x09}, // 0x35 5
+  {0x00, 0x1e, 0x15, 0x1d}, // 0x36 6
+  {0x00, 0x19, 0x05, 0x03}, // 0x37 7
+  {0x00, 0x1f, 0x15, 0x1f}, // 0x38 8
+  {0x00, 0x17, 0x15, 0x0f}, // 0x39 9
+  {0x00, 0x00, 0x0a, 0x00}, // 0x3a :
+  {0x00, 0x10, 0x0a, 0x00}, // 0x3b ;
+  {0x00, 0x04, 0x0a, 0x11}, // 0x3c <
+  {0x00, 0x0a, 0x0a, 0x0a}, // 0x3d =
+  {0x00, 0x11, 0x0a, 0x04}, // 0x3e >
+  {0x00, 0x01, 0x05, 0x12}, // 0x3f ?
+  {0x00, 0x00, 0x00, 0x00}, // 0x40 @
+  {0x00, 0x1e, 0x05, 0x1e}, // 0x41 A
+  {0x00, 0x1f, 0x15, 0x0a}, // 0x42 B
+  {0x00, 0x0e, 0x11, 0x11}, // 0x43 C
+  {0x00, 0x1f, 0x11, 0x0e}, // 0x44 D
+  {0x00, 0x1f, 0x15, 0x11}, // 0x45 E
+  {0x00, 0x1f, 0x05, 0x01}, // 0x46 F
+  {0x00, 0x0e, 0x11, 0x1d}, // 0x47 G
+  {0x00, 0x1f, 0x04, 0x1f}, // 0x48 H
+  {0x00, 0x11, 0x1f, 0x11}, // 0x49 I
+  {0x00, 0x18, 0x10, 0x1f}, // 0x4a J
+  {0x00, 0x1f, 0x04, 0x1b}, // 0x4b K
+  {0x00, 0x1f, 0x10, 0x10}, // 0x4c L
+  {0x00, 0x1f, 0x06, 0x1f}, // 0x4d M
+  {0x00, 0x1f, 0x01, 0x1e}, // 0x4e N
+  {0x00, 0x1f, 0x11, 0x1f}, // 0x4f O
+  {0x00, 0x1f, 0x05, 0x02}, // 0x50 P
+  {0x00, 0x0f, 0x19, 0x1f}, // 0x51 Q
+  {0x00, 0x1f, 0x05, 0x1a}, // 0x52 R
+  {0x00, 0x12, 0x15, 0x09}, // 0x53 S
+  {0x00, 0x01, 0x1f, 0x01}, // 0x54 T
+  {0x00, 0x1f, 0x10, 0x1f}, // 0x55 U
+  {0x00, 0x0f, 0x10, 0x0f}, // 0x56 V
+  {0x00, 0x1f, 0x08, 0x1f}, // 0x57 W
+  {0x00, 0x1b, 0x04, 0x1b}, // 0x58 X
+  {0x00, 0x03, 0x1c, 0x03}, // 0x59 Y
+  {0x00, 0x19, 0x15, 0x13}, // 0x5a Z
+  {0x00, 0x1f, 0x11, 0x11}, // 0x5b [
+  {0x00, 0x03, 0x04, 0x18}, // 0x5c backslash
+  {0x00, 0x11, 0x11, 0x1f}, // 0x5d ]
 };
 
 #endif /* FONT_4X6 */
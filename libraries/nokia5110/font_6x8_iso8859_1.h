@@ -54,7 +54,7 @@ static const uint8_t smallFont[][6] PROGMEM =
   {0x00, 0x07, 0x00, 0x07, 0x00, 0x00}, // 0x22 "
   {0x14, 0x7F, 0x14, 0x7F, 0x14, 0x00}, // 0x23 #
   {0x24, 0x2A, 0x7F, 0x2A, 0x12, 0x00}, // 0x24 $
-  {0xC4, 0xC8, 0x10, 0x26, 0x46, 0x00}, // 0x25 %
+  {0x23, 0x13, 0x08, 0x64, 0x62, 0x00}, // 0x25 %
   {0x36, 0x49, 0x55, 0x22, 0x50, 0x00}, // 0x26 &
   {0x00, 0x05, 0x03, 0x00, 0x00, 0x00}, // 0x27 '
   {0x00, 0x1C, 0x22, 0x41, 0x00, 0x00}, // 0x28 (
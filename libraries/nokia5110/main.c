@@ -7,12 +7,8 @@ void init(void)
 {
   _PROTECTED_WRITE(CLKCTRL.OSCHFCTRLA, CLKCTRL_FRQSEL_4M_gc);
 
+  // SCE PD3, RST PD4, DC PD2, SD PD1, SCL PD0, see nokia5110.h
   NOKIA_init(
-    &PORTD, 3, //sce_pin,
-    &PORTD, 4, //rst_pin,
-    &PORTD, 2, //dc_pin,
-    &PORTD, 1, //sd_pin,
-    &PORTD, 0, //scl_pin,
     0xd0,   //vop,
     NOKIA_ORIENTATION_180
   );
@@ -43,4 +39,4 @@ int main(void)
     vop++;
     _delay_ms(20);
   }
-}
\ No newline at end of file
+}
\ No newline at end of file
@@ -12,21 +12,24 @@
  * * 2015-06-09 originally created
  * * 2025-09-05 ported to the AVR-Dx family
  * * 2025-10-20 added tiny font
+ * * 2026-10-18 dirty column spans, NOKIA_update() sends only the changes
+ * * 2026-10-18 pins fixed at compile time, sbi/cbi on the VPORT registers
+ * * 2026-10-18 one core for the bit-banged, SPI and USART transports
+ * * 2026-10-18 tiny font in column bytes, written like NOKIA_putchar()
  */
 
 #include "nokia5110.h"
+#include <font_6x8_iso8859_1.h>
+#include <font_4x6.h>
 
 /**
- * @brief globals
+ * @brief pins on the VPORT registers, single-cycle sbi/cbi instructions
+ *        which can not collide with an interrupt changing another pin of the
+ *        port
  */
-typedef struct
-{
-  volatile PORT_t *Port;
-  uint8_t Pin_bm;
-} PIN_t;
-
-PIN_t NOKIA_RST, NOKIA_SCE, NOKIA_DC, NOKIA_SD, NOKIA_SCL;
-
+#define NOKIA_SET(pin) (NOKIA_##pin##_VPORT.OUT |= (1 << NOKIA_##pin##_PIN))
+#define NOKIA_CLR(pin) (NOKIA_##pin##_VPORT.OUT &= ~(1 << NOKIA_##pin##_PIN))
+#define NOKIA_OUT(pin) (NOKIA_##pin##_VPORT.DIR |= (1 << NOKIA_##pin##_PIN))
 
 /**
  * @name NOKIA_FRAMEBUFFER
@@ -36,36 +39,91 @@ uint8_t NOKIA_FRAMEBUFFER[NOKIA_SIZEX*NOKIA_SIZEY/8];
 uint8_t NOKIA_ORIENTATION = 0;
 
 /**
- * @name setPin
- * @param pin  instance of struct PIN_t, containing PORT and PIN
- * @return none
- * @brief sets an output pin to a logical 1
+ * @name NOKIA_dirtyMin, NOKIA_dirtyMax
+ * @brief changed columns of each bank of 8 rows since the last NOKIA_update(),
+ *        a bank is clean if NOKIA_dirtyMin > NOKIA_dirtyMax
  */
-void setPin(PIN_t pin)
-{
-  pin.Port->OUTSET = pin.Pin_bm;
-}
+uint8_t NOKIA_dirtyMin[NOKIA_BANKS] = {0, 0, 0, 0, 0, 0};
+uint8_t NOKIA_dirtyMax[NOKIA_BANKS] = {NOKIA_SIZEX-1, NOKIA_SIZEX-1, NOKIA_SIZEX-1,
+                                       NOKIA_SIZEX-1, NOKIA_SIZEX-1, NOKIA_SIZEX-1};
+
+static volatile uint8_t NOKIA_dcState = 0; // level of the DC pin, 1 - data,
+                                            // toggled by NOKIA_updateAsync()
 
 /**
- * @name clrPin
- * @param pin  instance of struct PIN_t, containing PORT and PIN
- * @return none
- * @brief sets an output pin to a logical 0
+ * @brief transport: NOKIA_portInit(), NOKIA_begin(), NOKIA_end(),
+ *        NOKIA_flush(), NOKIA_setOrder(), NOKIA_sendCommand() and
+ *        NOKIA_sendSpan() are inlined into the functions below
+ */
+#if NOKIA_TRANSPORT == NOKIA_TRANSPORT_BITBANG
+
+#include "nokia5110_bitbang.h"
+
+#else
+
+/**
+ * @brief state of NOKIA_updateAsync()
+ */
+#define NOKIA_ASYNC_COLUMN 0 // next: column address of the next span
+#define NOKIA_ASYNC_ROW    1 // next: bank address
+#define NOKIA_ASYNC_FIRST  2 // next: first data byte, switch DC
+#define NOKIA_ASYNC_DATA   3 // next: data byte
+#define NOKIA_ASYNC_END    4 // waiting for the last byte to be shifted out
+
+volatile uint8_t NOKIA_busy = 0;
+static uint8_t NOKIA_asyncMin[NOKIA_BANKS];
+static uint8_t NOKIA_asyncMax[NOKIA_BANKS];
+static uint8_t NOKIA_asyncBank, NOKIA_asyncState, NOKIA_asyncCount;
+static uint8_t *NOKIA_asyncPtr;
+static void (*NOKIA_asyncDone)(void);
+
+static void NOKIA_asyncNext(void);
+static void NOKIA_asyncComplete(void);
+
+/**
+ * @name NOKIA_reverse
+ * @param b  byte
+ * @return uint8_t b with reversed bit order
+ * @brief commands are reversed while the data is sent LSB first
  */
-void clrPin(PIN_t pin)
+static uint8_t NOKIA_reverse(uint8_t b)
 {
-  pin.Port->OUTCLR = pin.Pin_bm;
+  b = (b >> 4) | (b << 4);
+  b = ((b & 0xcc) >> 2) | ((b & 0x33) << 2);
+  b = ((b & 0xaa) >> 1) | ((b & 0x55) << 1);
+  return b;
 }
 
+#if NOKIA_TRANSPORT == NOKIA_TRANSPORT_SPI
+#include "nokia5110_spi.h"
+#else
+#include "nokia5110_usart.h"
+#endif
+#include "nokia5110_buffered.h"
+
+#endif
+
 /**
- * @name outdirPin
- * @param pin  instance of struct PIN_t, containing PORT and PIN
+ * @name NOKIA_setDC
+ * @param data  1 for data-mode, 0 for command-mode
  * @return none
- * @brief declares a pin to be an output
+ * @brief switches the DC pin after the bytes of the other mode are sent
  */
-void outdirPin(PIN_t pin)
+static inline void NOKIA_setDC(uint8_t data)
 {
-  pin.Port->DIRSET = pin.Pin_bm;
+  if (data != NOKIA_dcState)
+  {
+    NOKIA_flush();
+    if (data)
+    {
+      NOKIA_SET(DC);
+    }
+    else
+    {
+      NOKIA_CLR(DC);
+    }
+    NOKIA_dcState = data;
+  }
 }
 
 /**
@@ -76,29 +134,10 @@ void outdirPin(PIN_t pin)
  */
 void NOKIA_writeCommand (uint8_t command )
 {
-  uint8_t i;
-  // the bit-banging routines may not be interrupted!
-  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
-  {
-    clrPin(NOKIA_SCE);    //enable LCD
-    clrPin(NOKIA_DC);     // set LCD into command mode
-    clrPin(NOKIA_SCL);
-    for (i=0; i<8; i++)
-    {
-      if (command & 0b10000000)
-      {
-        setPin(NOKIA_SD);
-      }
-      else
-      {
-        clrPin(NOKIA_SD);
-      }
-      setPin(NOKIA_SCL);
-      clrPin(NOKIA_SCL);
-      command <<= 1;
-    }
-    setPin(NOKIA_SCE);  //disable LCD
-  }
+  NOKIA_begin();        // enable LCD
+  NOKIA_setDC(0);       // set LCD into command mode
+  NOKIA_sendCommand(command);
+  NOKIA_end();          // disable LCD
 }
 
 /**
@@ -109,52 +148,11 @@ void NOKIA_writeCommand (uint8_t command )
  */
 void NOKIA_writeData (uint8_t data )
 {
-  uint8_t i;
-  // the bit-banging routines may not be interrupted!
-  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
-  {
-    clrPin(NOKIA_SCE);    // enable LCD
-    setPin(NOKIA_DC);     // set LCD into command mode
-    clrPin(NOKIA_SCL);
-
-    switch (NOKIA_ORIENTATION)
-    {
-      case NOKIA_ORIENTATION_180:
-        for (i=0; i<8; i++)
-        {
-          if (data & 0b00000001)
-          {
-            setPin(NOKIA_SD);
-          }
-          else
-          {
-            clrPin(NOKIA_SD);
-          }
-          setPin(NOKIA_SCL);
-          clrPin(NOKIA_SCL);
-          data >>= 1;
-        }
-        break;
-
-      default:
-        for (i=0; i<8; i++)
-        {
-          if (data & 0b10000000)
-          {
-            setPin(NOKIA_SD);
-          }
-          else
-          {
-            clrPin(NOKIA_SD);
-          }
-          setPin(NOKIA_SCL);
-          clrPin(NOKIA_SCL);
-          data <<= 1;
-        }
-        break;
-    }
-    setPin(NOKIA_SCE);   // disable LCD
-  }
+  NOKIA_begin();        // enable LCD
+  NOKIA_setOrder();
+  NOKIA_setDC(1);       // set LCD into data mode
+  NOKIA_sendSpan(&data, 1);
+  NOKIA_end();          // disable LCD
 }
 
 /**
@@ -162,7 +160,7 @@ void NOKIA_writeData (uint8_t data )
  * @param x x-coordinate 0..83
  * @param y y-coordinate 0..47
  * @return none
- * @brief sets the displays write pointer - for partial writes (not used)
+ * @brief sets the displays write pointer - for partial writes
  */
 void NOKIA_gotoXY ( uint8_t x, uint8_t y )
 {
@@ -170,6 +168,44 @@ void NOKIA_gotoXY ( uint8_t x, uint8_t y )
     NOKIA_writeCommand (0x40 | (y/8));   //row
 }
 
+/**
+ * @name NOKIA_markdirty
+ * @param x0  first column 0..83
+ * @param x1  last column 0..83
+ * @param y0  first row 0..47
+ * @param y1  last row 0..47
+ * @return none
+ * @brief marks a rectangle of the framebuffer for the next NOKIA_update(),
+ *        needed after direct writes into NOKIA_FRAMEBUFFER
+ */
+void NOKIA_markdirty(uint8_t x0, uint8_t x1, uint8_t y0, uint8_t y1)
+{
+  uint8_t b;
+  if ((x0 >= NOKIA_SIZEX) || (y0 >= NOKIA_SIZEY))
+  {
+    return;
+  }
+  if (x1 >= NOKIA_SIZEX)
+  {
+    x1 = NOKIA_SIZEX-1;
+  }
+  if (y1 >= NOKIA_SIZEY)
+  {
+    y1 = NOKIA_SIZEY-1;
+  }
+  for (b=y0/8; b<=y1/8; b++)
+  {
+    if (x0 < NOKIA_dirtyMin[b])
+    {
+      NOKIA_dirtyMin[b] = x0;
+    }
+    if (x1 > NOKIA_dirtyMax[b])
+    {
+      NOKIA_dirtyMax[b] = x1;
+    }
+  }
+}
+
 /**
  * @name NOKIA_fillbuffer
  * @param value byte value to fill the display with
@@ -179,6 +215,7 @@ void NOKIA_gotoXY ( uint8_t x, uint8_t y )
 void NOKIA_fillbuffer(uint8_t value)
 {
   memset(NOKIA_FRAMEBUFFER, value, NOKIA_SIZEX*NOKIA_SIZEY/8);
+  NOKIA_markdirty(0, NOKIA_SIZEX-1, 0, NOKIA_SIZEY-1);
 }
 
 /**
@@ -196,31 +233,199 @@ void NOKIA_clearbuffer(void)
  * @name NOKIA_update
  * @param none
  * @return none
- * @brief updates the display with the current framebuffer
+ * @brief sends the changed column spans of the framebuffer to the display
  */
 void NOKIA_update (void)
 {
-  uint16_t i;
+  uint8_t b, x0, x1;
 
-  NOKIA_gotoXY(0,0);      // start with (0,0) position
-  switch (NOKIA_ORIENTATION)
+  NOKIA_begin();          // enable LCD for all spans
+  NOKIA_setOrder();
+  for (b=0; b<NOKIA_BANKS; b++)
   {
-  case NOKIA_ORIENTATION_180:
-    for(i=0; i<(NOKIA_SIZEX*NOKIA_SIZEY/8); i++)
+    x0 = NOKIA_dirtyMin[b];
+    x1 = NOKIA_dirtyMax[b];
+    if (x0 > x1)
     {
-      NOKIA_writeData(NOKIA_FRAMEBUFFER[NOKIA_SIZEX*NOKIA_SIZEY/8-i-1]);
+      continue;           // nothing changed in this bank
     }
-    break;
+    NOKIA_dirtyMin[b] = 0xff;
+    NOKIA_dirtyMax[b] = 0;
+    NOKIA_setDC(0);       // command mode, set the write pointer
+    switch (NOKIA_ORIENTATION)
+    {
+      case NOKIA_ORIENTATION_180:
+        // the display shows the buffer mirrored in x and y
+        NOKIA_sendCommand(0x80 | (NOKIA_SIZEX-1-x1));
+        NOKIA_sendCommand(0x40 | (NOKIA_BANKS-1-b));
+        NOKIA_setDC(1);
+        NOKIA_sendSpan(&NOKIA_FRAMEBUFFER[x1+NOKIA_SIZEX*b], x1-x0+1);
+        break;
+
+      default:
+        NOKIA_sendCommand(0x80 | x0);
+        NOKIA_sendCommand(0x40 | b);
+        NOKIA_setDC(1);
+        NOKIA_sendSpan(&NOKIA_FRAMEBUFFER[x0+NOKIA_SIZEX*b], x1-x0+1);
+        break;
+    }
+  }
+  NOKIA_end();            // disable LCD
+}
+
+#if NOKIA_TRANSPORT != NOKIA_TRANSPORT_BITBANG
+/**
+ * @name NOKIA_asyncNext
+ * @param none
+ * @return none
+ * @brief loads the next byte of NOKIA_updateAsync() into the TX buffer, or
+ *        waits for the end of the transmission before DC is switched
+ * @note internal use, called from the interrupt of the transport with room
+ *       in the TX buffer
+ */
+static void NOKIA_asyncNext(void)
+{
+  uint8_t b, x0, x1, cmd;
+
+  switch (NOKIA_asyncState)
+  {
+    case NOKIA_ASYNC_COLUMN:
+      b = NOKIA_asyncBank;
+      while ((b < NOKIA_BANKS) && (NOKIA_asyncMin[b] > NOKIA_asyncMax[b]))
+      {
+        b++;
+      }
+      NOKIA_asyncBank = b;
+      if (b >= NOKIA_BANKS)
+      {                                     // all spans loaded
+        NOKIA_asyncState = NOKIA_ASYNC_END;
+        NOKIA_irqComplete();
+        return;
+      }
+      if (NOKIA_dcState)
+      {                                     // command-mode after the data
+        NOKIA_irqComplete();
+        return;
+      }
+      x0 = NOKIA_asyncMin[b];
+      x1 = NOKIA_asyncMax[b];
+      NOKIA_asyncCount = x1-x0+1;
+      if (NOKIA_ORIENTATION == NOKIA_ORIENTATION_180)
+      {
+        NOKIA_asyncPtr = &NOKIA_FRAMEBUFFER[x1+NOKIA_SIZEX*b];
+        cmd = NOKIA_reverse(0x80 | (NOKIA_SIZEX-1-x1));
+      }
+      else
+      {
+        NOKIA_asyncPtr = &NOKIA_FRAMEBUFFER[x0+NOKIA_SIZEX*b];
+        cmd = 0x80 | x0;
+      }
+      NOKIA_txPut(cmd);
+      NOKIA_asyncState = NOKIA_ASYNC_ROW;
+      break;
+
+    case NOKIA_ASYNC_ROW:
+      if (NOKIA_ORIENTATION == NOKIA_ORIENTATION_180)
+      {
+        cmd = NOKIA_reverse(0x40 | (NOKIA_BANKS-1-NOKIA_asyncBank));
+      }
+      else
+      {
+        cmd = 0x40 | NOKIA_asyncBank;
+      }
+      NOKIA_txPut(cmd);
+      NOKIA_asyncState = NOKIA_ASYNC_FIRST;
+      break;
 
-  default:
-    for(i=0; i<(NOKIA_SIZEX*NOKIA_SIZEY/8); i++)
+    case NOKIA_ASYNC_FIRST:                 // data-mode after the commands
+      NOKIA_asyncState = NOKIA_ASYNC_DATA;
+      NOKIA_irqComplete();
+      return;
+
+    case NOKIA_ASYNC_DATA:
+      if (NOKIA_ORIENTATION == NOKIA_ORIENTATION_180)
+      {
+        NOKIA_txPut(*NOKIA_asyncPtr--);
+      }
+      else
+      {
+        NOKIA_txPut(*NOKIA_asyncPtr++);
+      }
+      if (--NOKIA_asyncCount == 0)
+      {
+        NOKIA_asyncBank++;
+        NOKIA_asyncState = NOKIA_ASYNC_COLUMN;
+      }
+      break;
+  }
+}
+
+/**
+ * @name NOKIA_asyncComplete
+ * @param none
+ * @return none
+ * @brief all bytes sent: switches DC and continues, or ends the transfer
+ * @note internal use, called from the interrupt of the transport; TXCIF
+ *       stays set for NOKIA_flush()
+ */
+static void NOKIA_asyncComplete(void)
+{
+  if (NOKIA_asyncState == NOKIA_ASYNC_END)
+  {
+    NOKIA_irqOff();
+    NOKIA_busy = 0;
+    if (NOKIA_asyncDone)
     {
-      NOKIA_writeData(NOKIA_FRAMEBUFFER[i]);
+      NOKIA_asyncDone();
     }
-    break;
+    return;
   }
-  NOKIA_gotoXY(0,0);      // bring the XY position back to (0,0)
+  NOKIA_dcState ^= 1;
+  if (NOKIA_dcState)
+  {
+    NOKIA_SET(DC);
+  }
+  else
+  {
+    NOKIA_CLR(DC);
+  }
+  NOKIA_irqData();
+  NOKIA_asyncNext();
+}
+
+/**
+ * @name NOKIA_updateAsync
+ * @param done  function called from the interrupt at the end of the
+ *              transfer, or NULL
+ * @return uint8_t 1 if the transfer was started, 0 if a transfer is still
+ *         running
+ * @brief sends the changed column spans in the background, driven by the
+ *        data register empty interrupt of the SPI or USART
+ */
+uint8_t NOKIA_updateAsync (void (*done)(void))
+{
+  uint8_t b;
+
+  if (NOKIA_busy)
+  {
+    return 0;
+  }
+  for (b=0; b<NOKIA_BANKS; b++)
+  {                               // take over the spans, drawing goes on
+    NOKIA_asyncMin[b] = NOKIA_dirtyMin[b];
+    NOKIA_asyncMax[b] = NOKIA_dirtyMax[b];
+    NOKIA_dirtyMin[b] = 0xff;
+    NOKIA_dirtyMax[b] = 0;
+  }
+  NOKIA_setOrder();
+  NOKIA_asyncDone  = done;
+  NOKIA_asyncBank  = 0;
+  NOKIA_asyncState = NOKIA_ASYNC_COLUMN;
+  NOKIA_busy = 1;
+  NOKIA_irqData();
+  return 1;
 }
+#endif
 
 /**
  * @name NOKIA_clear
@@ -236,61 +441,28 @@ void NOKIA_clear ( void )
 
 /**
  * @name NOKIA_init
- * @param sce_port PORT-struct of the SCE pin
- * @param sce_pin pin number of the SCE pin
- * @param rst_port PORT-struct of the RST pin
- * @param rst_pin pin number of the RST pin
- * @param dc_port PORT-struct of the DC pin
- * @param dc_pin pin number of the DC pin
- * @param sd_port PORT-struct of the SD/DIN pin
- * @param sd_pin pin number of the SD/DIN pin
- * @param scl_port PORT-struct of the SCL/CLK pin
- * @param scl_pin pin number of the SCL/CLK pin
  * @param vop  the contrast voltage parameter 0..127
  * @param orientation  orientation of the display (0: 0°, 1: 180°)
  * @return none
- * @brief initialize the NOKIA display
+ * @brief initialize the transport selected by NOKIA_TRANSPORT and the NOKIA
+ *        display
  */
 void NOKIA_init (
-  volatile PORT_t *sce_port, uint8_t sce_pin,
-  volatile PORT_t *rst_port, uint8_t rst_pin,
-  volatile PORT_t *dc_port, uint8_t dc_pin,
-  volatile PORT_t *sd_port, uint8_t sd_pin,
-  volatile PORT_t *scl_port, uint8_t scl_pin,
   uint8_t vop,
   uint8_t orientation
 )
 {
-
   NOKIA_ORIENTATION = orientation;
-  NOKIA_SCE.Port = sce_port;
-  NOKIA_SCE.Pin_bm = 1 << sce_pin;
-  outdirPin(NOKIA_SCE);
-  NOKIA_RST.Port = rst_port;
-  NOKIA_RST.Pin_bm = 1 << rst_pin;
-  outdirPin(NOKIA_RST);
-  NOKIA_DC.Port = dc_port;
-  NOKIA_DC.Pin_bm = 1 << dc_pin;
-  outdirPin(NOKIA_DC);
-  NOKIA_SD.Port = sd_port;
-  NOKIA_SD.Pin_bm = 1 << sd_pin;
-  outdirPin(NOKIA_SD);
-  NOKIA_SCL.Port = scl_port;
-  NOKIA_SCL.Pin_bm = 1 << scl_pin;
-  outdirPin(NOKIA_SCL);
-
+  NOKIA_portInit();
+  NOKIA_OUT(RST);
+  NOKIA_CLR(DC);
+  NOKIA_dcState = 0;
+  NOKIA_OUT(DC);
   _delay_ms(100);
 
-  // the bit-banging routines may not be interrupted!
-  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
-  {
-    clrPin(NOKIA_SCE); // Enable LCD
-    clrPin(NOKIA_RST); // reset LCD
-
-    _delay_ms(100);
-    setPin(NOKIA_RST); // reset LCD
-    setPin(NOKIA_SCE); // disable LCD
-  }
+  NOKIA_CLR(RST); // reset LCD
+  _delay_ms(100);
+  NOKIA_SET(RST); // reset LCD
 
   NOKIA_writeCommand( 0x21 );  // LCD Extended Commands.
   NOKIA_writeCommand( 0x80 | vop );  // Set LCD Vop (Contrast).
@@ -299,7 +471,8 @@ void NOKIA_init (
   NOKIA_writeCommand( 0x20 );  // LCD Standard Commands, Horizontal addressing mode.
   NOKIA_writeCommand( 0x0c );  // LCD in normal mode.
 
-  NOKIA_clear();
+  NOKIA_markdirty(0, NOKIA_SIZEX-1, 0, NOKIA_SIZEY-1);
+  NOKIA_update();
 }
 
 /**
@@ -327,7 +500,16 @@ void NOKIA_setpixel(uint8_t x, uint8_t y)
 {
   if ((x < NOKIA_SIZEX) && (y < NOKIA_SIZEY))
   {
-    NOKIA_FRAMEBUFFER[(uint16_t) x+NOKIA_SIZEX*(y/8)] |= (1 << (y % 8));
+    uint8_t b = y/8;
+    NOKIA_FRAMEBUFFER[(uint16_t) x+NOKIA_SIZEX*b] |= (1 << (y % 8));
+    if (x < NOKIA_dirtyMin[b])
+    {
+      NOKIA_dirtyMin[b] = x;
+    }
+    if (x > NOKIA_dirtyMax[b])
+    {
+      NOKIA_dirtyMax[b] = x;
+    }
   }
 }
 
@@ -342,7 +524,16 @@ void NOKIA_clearpixel(uint8_t x, uint8_t y)
 {
   if ((x < NOKIA_SIZEX) && (y < NOKIA_SIZEY))
   {
-    NOKIA_FRAMEBUFFER[(uint16_t) x+NOKIA_SIZEX*(y/8)] &= ~(1 << (y % 8));
+    uint8_t b = y/8;
+    NOKIA_FRAMEBUFFER[(uint16_t) x+NOKIA_SIZEX*b] &= ~(1 << (y % 8));
+    if (x < NOKIA_dirtyMin[b])
+    {
+      NOKIA_dirtyMin[b] = x;
+    }
+    if (x > NOKIA_dirtyMax[b])
+    {
+      NOKIA_dirtyMax[b] = x;
+    }
   }
 }
 
@@ -361,6 +552,7 @@ void NOKIA_putchar(uint8_t x0, uint8_t y0, char ch, uint8_t attr)
   uint16_t m;
   yd = y0/8;
   ym = y0%8;
+  NOKIA_markdirty(x0, x0+5, y0, y0+7);
   for (i=0; i<6; i++)
   {
     fontbyte = pgm_read_byte(&smallFont[(uint8_t)ch][i]);
@@ -402,50 +594,43 @@ void NOKIA_putchar(uint8_t x0, uint8_t y0, char ch, uint8_t attr)
  */
 void NOKIA_puttinychar(uint8_t x0, uint8_t y0, char ch, uint8_t attr)
 {
-  uint8_t i, fontbyte;
-  uint16_t m;
+  uint8_t i, fontbyte, shift, lower;
+  uint16_t m, mask, column;
+  const uint8_t *glyph;
+  if (y0 >= NOKIA_SIZEY)
+  {
+    return;
+  }
   if (ch > 93)
   {
     ch = ch & 0b01011111;
   }
-  for (i=0; i<3; i++)
+  NOKIA_markdirty(x0, x0+3, y0, y0+5);
+  glyph = tinyFont[(uint8_t)ch];
+  shift = 1 << (y0%8);        // one multiplication moves a column into place
+  mask  = 0b00111111 * shift; // the 6 rows in this and the next bank
+  lower = (y0/8 < NOKIA_BANKS-1) && (mask >> 8);
+  m = (uint16_t) x0+NOKIA_SIZEX*(y0/8);
+  for (i=0; (i<4) && (x0+i<NOKIA_SIZEX); i++, m++)
   {
-    fontbyte = pgm_read_byte(&tinyFont[(uint8_t)ch][i]);
+    fontbyte = pgm_read_byte(&glyph[i]);
     switch (attr)
     {
       case  0:
           break;
       case  1:
-          fontbyte ^= 0xff;
+          fontbyte ^= 0b00111111;
           break;
       case  2:
-          if (i==2)
-          {
-            fontbyte |= 0b00001111;
-          }
+          fontbyte |= 0b00100000;
           break;
     }
-    uint8_t fh = (fontbyte & 0xf0) >> 4;
-    for (uint8_t j=0; j<4; j++)
+    column = fontbyte * shift;
+    NOKIA_FRAMEBUFFER[m] = (NOKIA_FRAMEBUFFER[m] & ~(uint8_t)mask) | (uint8_t)column;
+    if (lower)
     {
-      if (fh & 0b00001000)
-      {
-        NOKIA_setpixel(x0+j,y0+2*i);
-      }
-      else
-      {
-        NOKIA_clearpixel(x0+j,y0+2*i);
-      }
-      if (fontbyte & 0b00001000)
-      {
-        NOKIA_setpixel(x0+j,y0+1+2*i);
-      }
-      else
-      {
-        NOKIA_clearpixel(x0+j,y0+1+2*i);
-      }
-      fontbyte <<= 1;
-      fh <<= 1;
+      NOKIA_FRAMEBUFFER[m+NOKIA_SIZEX] = (NOKIA_FRAMEBUFFER[m+NOKIA_SIZEX] & ~(uint8_t)(mask >> 8))
+                                       | (uint8_t)(column >> 8);
     }
   }
 }
@@ -538,6 +723,7 @@ void NOKIA_scroll(int8_t dy)
 {
   int8_t y1;
   uint8_t  x, y, dy1, dy8, b1, b2;
+  NOKIA_markdirty(0, NOKIA_SIZEX-1, 0, NOKIA_SIZEY-1);
   if (dy>0)
   {
     dy8 = dy/8;
@@ -12,6 +12,9 @@
  * * 2015-06-09 originally created
  * * 2025-09-05 ported to the AVR-Dx family
  * * 2025-10-20 added tiny font
+ * * 2026-10-18 dirty column spans, NOKIA_update() sends only the changes
+ * * 2026-10-18 pins fixed at compile time, sbi/cbi on the VPORT registers
+ * * 2026-10-18 one core for the bit-banged, SPI and USART transports
  *
  */
 #ifndef NOKIA5110_H_
@@ -19,24 +22,147 @@
 
 #include <avr/io.h>
 #include <stdlib.h>
-#include <util/atomic.h>
+#include <avr/interrupt.h>
 #include <util/delay.h>
 #include <avr/pgmspace.h>
 #include <string.h>
-#include <font_6x8_iso8859_1.h>
-#include <font_4x6.h>
 
 #define NOKIA_SIZEX 84
 #define NOKIA_SIZEY 48
+#define NOKIA_BANKS (NOKIA_SIZEY/8)
 #define NOKIA_ORIENTATION_0   0
 #define NOKIA_ORIENTATION_180 1
 #define NOKIA_NORMAL    0
 #define NOKIA_INVERSE   1
 #define NOKIA_UNDERLINE 2
 
+/**
+ * @brief transport to the display, chosen at compile time for the whole
+ *        project, e.g. -DNOKIA_TRANSPORT=NOKIA_TRANSPORT_SPI
+ *        - NOKIA_TRANSPORT_BITBANG: any five pins
+ *        - NOKIA_TRANSPORT_SPI: hardware SPI in buffered mode
+ *        - NOKIA_TRANSPORT_USART: USART in host SPI mode (MSPI)
+ */
+#define NOKIA_TRANSPORT_BITBANG 0
+#define NOKIA_TRANSPORT_SPI     1
+#define NOKIA_TRANSPORT_USART   2
+
+#ifndef NOKIA_TRANSPORT
+#define NOKIA_TRANSPORT NOKIA_TRANSPORT_BITBANG
+#endif
+
+/**
+ * @brief pins of the display, fixed at compile time so that they are
+ *        switched with single-cycle sbi/cbi instructions on the VPORT
+ *        registers; can be given on the compiler command line, e.g.
+ *        -DNOKIA_DC_VPORT=VPORTA -DNOKIA_DC_PIN=5
+ */
+#if NOKIA_TRANSPORT == NOKIA_TRANSPORT_BITBANG
+
+#ifndef NOKIA_SCE_VPORT
+#define NOKIA_SCE_VPORT VPORTD
+#define NOKIA_SCE_PIN   3
+#endif
+#ifndef NOKIA_RST_VPORT
+#define NOKIA_RST_VPORT VPORTD
+#define NOKIA_RST_PIN   4
+#endif
+#ifndef NOKIA_DC_VPORT
+#define NOKIA_DC_VPORT  VPORTD
+#define NOKIA_DC_PIN    2
+#endif
+#ifndef NOKIA_SD_VPORT
+#define NOKIA_SD_VPORT  VPORTD
+#define NOKIA_SD_PIN    1
+#endif
+#ifndef NOKIA_SCL_VPORT
+#define NOKIA_SCL_VPORT VPORTD
+#define NOKIA_SCL_PIN   0
+#endif
+
+/**
+ * @brief extra CPU cycles for the 100 ns setup time and clock pulse width of
+ *        the PCD8544, 0 up to 10 MHz
+ */
+#define NOKIA_BB_WAIT ((F_CPU-1)/10000000UL)
+
+#else
+
+#ifndef NOKIA_RST_VPORT
+#define NOKIA_RST_VPORT VPORTA
+#define NOKIA_RST_PIN   2
+#endif
+#ifndef NOKIA_DC_VPORT
+#define NOKIA_DC_VPORT  VPORTA
+#define NOKIA_DC_PIN    3
+#endif
+
+/**
+ * 1 while NOKIA_updateAsync() is sending, the other functions which write to
+ * the display wait for the end of the transfer
+ */
+extern volatile uint8_t NOKIA_busy;
+
+#endif
+
+#if NOKIA_TRANSPORT == NOKIA_TRANSPORT_SPI
+/**
+ * @brief SPI module, its interrupt vector for NOKIA_updateAsync() and the
+ *        prescaler of the SPI clock (SPI_CLK2X_bm | SPI_PRESC_DIV4_gc for
+ *        F_CPU/2), the PCD8544 accepts up to 4 MHz
+ */
+#ifndef NOKIA_SPI
+#define NOKIA_SPI        SPI0
+#define NOKIA_SPI_INTVEC SPI0_INT_vect
+#endif
+#ifndef NOKIA_SPI_PRESC
+#define NOKIA_SPI_PRESC  SPI_PRESC_DIV4_gc
+#endif
+#endif
+
+#if NOKIA_TRANSPORT == NOKIA_TRANSPORT_USART
+/**
+ * @brief USART module and its interrupt vectors for NOKIA_updateAsync()
+ */
+#ifndef NOKIA_USART
+#define NOKIA_USART        USART1
+#define NOKIA_USART_DREVEC USART1_DRE_vect
+#define NOKIA_USART_TXCVEC USART1_TXC_vect
+#endif
+
+/**
+ * @brief SPI clock of the USART, at most F_CPU/2; the PCD8544 accepts up to
+ *        4 MHz
+ */
+#ifndef NOKIA_USPI_CLOCK
+#define NOKIA_USPI_CLOCK 4000000UL
+#endif
+
+/**
+ * @brief BAUD register: f = F_CPU/(2*BAUD[15:6]), the fractional bits are
+ *        not used in host SPI mode; rounded up, the clock never exceeds
+ *        NOKIA_USPI_CLOCK
+ */
+#define NOKIA_USPI_DIV ((F_CPU + 2*NOKIA_USPI_CLOCK - 1)/(2*NOKIA_USPI_CLOCK))
+#if NOKIA_USPI_DIV < 1
+#define NOKIA_USPI_BAUD (1 << 6)
+#else
+#define NOKIA_USPI_BAUD ((uint16_t)NOKIA_USPI_DIV << 6)
+#endif
+#endif
+
 extern uint8_t NOKIA_FRAMEBUFFER[NOKIA_SIZEX*NOKIA_SIZEY/8];
 extern uint8_t NOKIA_ORIENTATION;
 
+/**
+ * changed columns of each bank of 8 rows since the last NOKIA_update(), a
+ * bank is clean if NOKIA_dirtyMin > NOKIA_dirtyMax. The drawing functions
+ * update the spans, direct writes into NOKIA_FRAMEBUFFER need
+ * NOKIA_markdirty().
+ */
+extern uint8_t NOKIA_dirtyMin[NOKIA_BANKS];
+extern uint8_t NOKIA_dirtyMax[NOKIA_BANKS];
+
 /**
  * @name NOKIA_writeCommand
  * @param data uint8_t of data
@@ -58,10 +184,22 @@ void NOKIA_writeData (uint8_t data );
  * @param x x-coordinate 0..83
  * @param y y-coordinate 0..47
  * @return none
- * @brief sets the displays write pointer - for partial writes (not used)
+ * @brief sets the displays write pointer - for partial writes
  */
 void NOKIA_gotoXY ( uint8_t x, uint8_t y );
 
+/**
+ * @name NOKIA_markdirty
+ * @param x0  first column 0..83
+ * @param x1  last column 0..83
+ * @param y0  first row 0..47
+ * @param y1  last row 0..47
+ * @return none
+ * @brief marks a rectangle of the framebuffer for the next NOKIA_update(),
+ *        needed after direct writes into NOKIA_FRAMEBUFFER
+ */
+void NOKIA_markdirty(uint8_t x0, uint8_t x1, uint8_t y0, uint8_t y1);
+
 /**
  * @name NOKIA_fillbuffer
  * @param value byte value to fill the display with
@@ -82,10 +220,28 @@ void NOKIA_clearbuffer(void);
  * @name NOKIA_update
  * @param none
  * @return none
- * @brief updates the display with the current framebuffer
+ * @brief sends the changed column spans of the framebuffer to the display
  */
 void NOKIA_update (void);
 
+#if NOKIA_TRANSPORT != NOKIA_TRANSPORT_BITBANG
+/**
+ * @name NOKIA_updateAsync
+ * @param done  function called from the interrupt at the end of the
+ *              transfer, or NULL
+ * @return uint8_t 1 if the transfer was started, 0 if a transfer is still
+ *         running
+ * @brief sends the changed column spans in the background, driven by the
+ *        data register empty interrupt of the SPI or USART. The spans are
+ *        taken at the start; drawing during the transfer is allowed and is
+ *        sent by the next update, but a span which is just being sent may
+ *        show the new contents partially.
+ * @note needs enabled interrupts, not available with the bit-banged
+ *       transport
+ */
+uint8_t NOKIA_updateAsync (void (*done)(void));
+#endif
+
 /**
  * @name NOKIA_clear
  * @param none
@@ -96,27 +252,14 @@ void NOKIA_clear ( void );
 
 /**
  * @name NOKIA_init
- * @param sce_port PORT-struct of the SCE pin
- * @param sce_pin pin number of the SCE pin
- * @param rst_port PORT-struct of the RST pin
- * @param rst_pin pin number of the RST pin
- * @param dc_port PORT-struct of the DC pin
- * @param dc_pin pin number of the DC pin
- * @param sd_port PORT-struct of the SD/DIN pin
- * @param sd_pin pin number of the SD/DIN pin
- * @param scl_port PORT-struct of the SCL/CLK pin
- * @param scl_pin pin number of the SCL/CLK pin
  * @param vop  the contrast voltage parameter 0..127
  * @param orientation  orientation of the display (0: 0°, 1: 180°)
  * @return none
- * @brief initialize the NOKIA display
+ * @brief initialize the transport selected by NOKIA_TRANSPORT and the NOKIA
+ *        display; SPI: the SCK and MOSI pins, USART: the XCK and TXD pins
+ *        need to be outputs
  */
 void NOKIA_init (
-  volatile PORT_t *sce_port, uint8_t sce_pin,
-  volatile PORT_t *rst_port, uint8_t rst_pin,
-  volatile PORT_t *dc_port, uint8_t dc_pin,
-  volatile PORT_t *sd_port, uint8_t sd_pin,
-  volatile PORT_t *scl_port, uint8_t scl_pin,
   uint8_t vop,
   uint8_t orientation
 );
@@ -0,0 +1,159 @@
+/**
+ * @file nokia5110_bitbang.h
+ * @brief bit-banged transport of the Nokia 5110 driver
+ *
+ * @author Uwe Zimmermann
+ *
+ * The library work is licensed under a MIT license.\n
+ * See https://github.com/uwezi/AVR-Dx
+ *
+ * Included by nokia5110.c only, the functions are inlined into the core.
+ * Every edge is a single-cycle sbi/cbi on the VPORT registers, the 8 bits of
+ * a byte are unrolled.
+ *
+ * ChangeLog:
+ * --------
+ * * 2026-10-18 created from nokia5110.c
+ */
+#ifndef NOKIA5110_BITBANG_H_
+#define NOKIA5110_BITBANG_H_
+
+#if NOKIA_BB_WAIT > 0
+#define NOKIA_WAIT() __builtin_avr_delay_cycles(NOKIA_BB_WAIT)
+#else
+#define NOKIA_WAIT()
+#endif
+
+/**
+ * @brief one bit: SD is cleared and set again if needed (3 cycles without a
+ *        branch), the PCD8544 samples SD on the rising edge of SCL
+ */
+#define NOKIA_SHIFTBIT(data, bit)   \
+  NOKIA_CLR(SD);                    \
+  if ((data) & (1 << (bit)))        \
+  {                                 \
+    NOKIA_SET(SD);                  \
+  }                                 \
+  NOKIA_WAIT();                     \
+  NOKIA_SET(SCL);                   \
+  NOKIA_WAIT();                     \
+  NOKIA_CLR(SCL)
+
+/**
+ * @name NOKIA_shiftMSB
+ * @param data  byte to be sent
+ * @return none
+ * @brief shifts one byte out, MSB first
+ * @note the PCD8544 is fully static, an interrupt only stretches the clock
+ *       and the interrupts stay enabled
+ */
+static inline void NOKIA_shiftMSB(uint8_t data)
+{
+  NOKIA_SHIFTBIT(data, 7);
+  NOKIA_SHIFTBIT(data, 6);
+  NOKIA_SHIFTBIT(data, 5);
+  NOKIA_SHIFTBIT(data, 4);
+  NOKIA_SHIFTBIT(data, 3);
+  NOKIA_SHIFTBIT(data, 2);
+  NOKIA_SHIFTBIT(data, 1);
+  NOKIA_SHIFTBIT(data, 0);
+}
+
+/**
+ * @name NOKIA_shiftLSB
+ * @param data  byte to be sent
+ * @return none
+ * @brief shifts one byte out, LSB first, for NOKIA_ORIENTATION_180
+ */
+static inline void NOKIA_shiftLSB(uint8_t data)
+{
+  NOKIA_SHIFTBIT(data, 0);
+  NOKIA_SHIFTBIT(data, 1);
+  NOKIA_SHIFTBIT(data, 2);
+  NOKIA_SHIFTBIT(data, 3);
+  NOKIA_SHIFTBIT(data, 4);
+  NOKIA_SHIFTBIT(data, 5);
+  NOKIA_SHIFTBIT(data, 6);
+  NOKIA_SHIFTBIT(data, 7);
+}
+
+/**
+ * @name NOKIA_portInit
+ * @brief SCE, SD and SCL as outputs, the display disabled
+ */
+static inline void NOKIA_portInit(void)
+{
+  NOKIA_SET(SCE);
+  NOKIA_OUT(SCE);
+  NOKIA_CLR(SD);
+  NOKIA_OUT(SD);
+  NOKIA_CLR(SCL);
+  NOKIA_OUT(SCL);
+}
+
+/**
+ * @name NOKIA_begin, NOKIA_end
+ * @brief enable/disable the display around a transfer
+ */
+static inline void NOKIA_begin(void)
+{
+  NOKIA_CLR(SCE);
+}
+
+static inline void NOKIA_end(void)
+{
+  NOKIA_SET(SCE);
+}
+
+/**
+ * @name NOKIA_flush
+ * @brief nothing to wait for, the bits are out when NOKIA_shiftMSB() returns
+ */
+static inline void NOKIA_flush(void)
+{
+}
+
+/**
+ * @name NOKIA_setOrder
+ * @brief the bit order is chosen per byte by NOKIA_sendSpan()
+ */
+static inline void NOKIA_setOrder(void)
+{
+}
+
+/**
+ * @name NOKIA_sendCommand
+ * @param command  command byte
+ * @brief commands are always sent MSB first
+ */
+static inline void NOKIA_sendCommand(uint8_t command)
+{
+  NOKIA_shiftMSB(command);
+}
+
+/**
+ * @name NOKIA_sendSpan
+ * @param p  first byte in the order of the display
+ * @param n  number of bytes 1..84
+ * @brief sends bytes of one bank, for NOKIA_ORIENTATION_180 backwards from
+ *        p and LSB first
+ */
+static inline void NOKIA_sendSpan(const uint8_t *p, uint8_t n)
+{
+  if (NOKIA_ORIENTATION == NOKIA_ORIENTATION_180)
+  {
+    do
+    {
+      NOKIA_shiftLSB(*p--);
+    } while (--n);
+  }
+  else
+  {
+    do
+    {
+      NOKIA_shiftMSB(*p++);
+    } while (--n);
+  }
+}
+
+#endif /* NOKIA5110_BITBANG_H_ */
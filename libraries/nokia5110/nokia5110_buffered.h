@@ -0,0 +1,122 @@
+/**
+ * @file nokia5110_buffered.h
+ * @brief common part of the hardware transports of the Nokia 5110 driver
+ *
+ * @author Uwe Zimmermann
+ *
+ * The library work is licensed under a MIT license.\n
+ * See https://github.com/uwezi/AVR-Dx
+ *
+ * Included by nokia5110.c only, after nokia5110_spi.h or nokia5110_usart.h.
+ * Both peripherals have a TX buffer in front of the shift register: the
+ * bytes of a span are loaded as soon as there is room, so the shift register
+ * runs without gaps, and DC is only switched after NOKIA_flush().
+ *
+ * ChangeLog:
+ * --------
+ * * 2026-10-18 created from nokia5110_hspi.c
+ */
+#ifndef NOKIA5110_BUFFERED_H_
+#define NOKIA5110_BUFFERED_H_
+
+#include <util/atomic.h>
+
+/**
+ * @name NOKIA_flush
+ * @param none
+ * @return none
+ * @brief waits until the last byte has left the shift register
+ * @note TXCIF is cleared after every write to the TX buffer
+ */
+static inline void NOKIA_flush(void)
+{
+  while (NOKIA_txDone() == 0);
+}
+
+/**
+ * @name NOKIA_begin, NOKIA_end
+ * @brief a transfer waits for the end of NOKIA_updateAsync()
+ */
+static inline void NOKIA_begin(void)
+{
+  while (NOKIA_busy) {}
+}
+
+static inline void NOKIA_end(void)
+{
+}
+
+/**
+ * @name NOKIA_setOrder
+ * @param none
+ * @return none
+ * @brief the display RAM is sent LSB first for NOKIA_ORIENTATION_180
+ */
+static inline void NOKIA_setOrder(void)
+{
+  uint8_t lsb = (NOKIA_ORIENTATION == NOKIA_ORIENTATION_180) ? 1 : 0;
+  if (NOKIA_txLSB() != lsb)
+  {
+    NOKIA_flush();
+    NOKIA_txToggleOrder();
+  }
+}
+
+/**
+ * @name NOKIA_send
+ * @param data  byte to be sent
+ * @return none
+ * @brief loads a byte into the TX buffer as soon as there is room, the
+ *        shift register is kept busy
+ * @note an interrupt between the write and the clearing of TXCIF could
+ *       outlast the queued bytes, TXCIF would be lost and NOKIA_flush()
+ *       would wait forever
+ */
+static inline void NOKIA_send(uint8_t data)
+{
+  while (NOKIA_txReady() == 0);
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    NOKIA_txPut(data);
+  }
+}
+
+/**
+ * @name NOKIA_sendCommand
+ * @param command  command byte
+ * @brief commands are reversed while the data is sent LSB first
+ */
+static inline void NOKIA_sendCommand(uint8_t command)
+{
+  if (NOKIA_txLSB())
+  {
+    command = NOKIA_reverse(command);
+  }
+  NOKIA_send(command);
+}
+
+/**
+ * @name NOKIA_sendSpan
+ * @param p  first byte in the order of the display
+ * @param n  number of bytes 1..84
+ * @brief sends bytes of one bank, for NOKIA_ORIENTATION_180 backwards from p
+ */
+static inline void NOKIA_sendSpan(const uint8_t *p, uint8_t n)
+{
+  if (NOKIA_ORIENTATION == NOKIA_ORIENTATION_180)
+  {
+    do
+    {
+      NOKIA_send(*p--);
+    } while (--n);
+  }
+  else
+  {
+    do
+    {
+      NOKIA_send(*p++);
+    } while (--n);
+  }
+}
+
+#endif /* NOKIA5110_BUFFERED_H_ */
@@ -0,0 +1,508 @@
+/**
+ * @file nokia5110_gfx.c
+ * @brief graphics primitives for the Nokia 5110 driver
+ *
+ * @author Uwe Zimmermann
+ *
+ * The library work is licensed under a MIT license.\n
+ * See https://github.com/uwezi/AVR-Dx
+ *
+ * ChangeLog:
+ * --------
+ * * 2026-10-18 created
+ * * 2026-10-18 bitmaps with NOKIA_blit(), NOKIA_blit_P()
+ */
+
+#include "nokia5110_gfx.h"
+
+/**
+ * @name NOKIA_fillspan
+ * @param p  first byte in the framebuffer
+ * @param n  number of bytes 1..84
+ * @param mask  pixels of each byte
+ * @param mode  NOKIA_DRAW_SET, NOKIA_DRAW_CLEAR or NOKIA_DRAW_XOR
+ * @return none
+ * @brief applies a mask to consecutive columns of one bank
+ */
+static void NOKIA_fillspan(uint8_t *p, uint8_t n, uint8_t mask, uint8_t mode)
+{
+  switch (mode)
+  {
+    case NOKIA_DRAW_CLEAR:
+      mask = ~mask;
+      do
+      {
+        *p++ &= mask;
+      } while (--n);
+      break;
+
+    case NOKIA_DRAW_XOR:
+      do
+      {
+        *p++ ^= mask;
+      } while (--n);
+      break;
+
+    default:
+      do
+      {
+        *p++ |= mask;
+      } while (--n);
+      break;
+  }
+}
+
+/**
+ * @name NOKIA_plot
+ * @param x  x-coordinate, may be outside of the display
+ * @param y  y-coordinate, may be outside of the display
+ * @param mode  NOKIA_DRAW_SET, NOKIA_DRAW_CLEAR or NOKIA_DRAW_XOR
+ * @return none
+ * @brief a single pixel for lines and circles
+ */
+static void NOKIA_plot(int16_t x, int16_t y, uint8_t mode)
+{
+  uint8_t b, bit;
+  uint8_t *p;
+
+  if ((x < 0) || (x >= NOKIA_SIZEX) || (y < 0) || (y >= NOKIA_SIZEY))
+  {
+    return;
+  }
+  b = y/8;
+  bit = 1 << (y%8);
+  p = &NOKIA_FRAMEBUFFER[(uint16_t) x+NOKIA_SIZEX*b];
+  switch (mode)
+  {
+    case NOKIA_DRAW_CLEAR:
+      *p &= ~bit;
+      break;
+    case NOKIA_DRAW_XOR:
+      *p ^= bit;
+      break;
+    default:
+      *p |= bit;
+      break;
+  }
+  if (x < NOKIA_dirtyMin[b])
+  {
+    NOKIA_dirtyMin[b] = x;
+  }
+  if (x > NOKIA_dirtyMax[b])
+  {
+    NOKIA_dirtyMax[b] = x;
+  }
+}
+
+/**
+ * @name NOKIA_fillrect
+ * @param x0, y0  one corner
+ * @param x1, y1  the opposite corner
+ * @param mode  NOKIA_DRAW_SET, NOKIA_DRAW_CLEAR or NOKIA_DRAW_XOR
+ * @return none
+ * @brief fills a rectangle bank by bank
+ */
+void NOKIA_fillrect(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t mode)
+{
+  uint8_t b, b1, n, mask, t;
+  uint8_t *p;
+
+  if (x0 > x1)
+  {
+    t = x0; x0 = x1; x1 = t;
+  }
+  if (y0 > y1)
+  {
+    t = y0; y0 = y1; y1 = t;
+  }
+  if ((x0 >= NOKIA_SIZEX) || (y0 >= NOKIA_SIZEY))
+  {
+    return;
+  }
+  if (x1 >= NOKIA_SIZEX)
+  {
+    x1 = NOKIA_SIZEX-1;
+  }
+  if (y1 >= NOKIA_SIZEY)
+  {
+    y1 = NOKIA_SIZEY-1;
+  }
+  NOKIA_markdirty(x0, x1, y0, y1);
+
+  n  = x1-x0+1;
+  b  = y0/8;
+  b1 = y1/8;
+  mask = 0xff << (y0%8);                // upper edge
+  p = &NOKIA_FRAMEBUFFER[(uint16_t) x0+NOKIA_SIZEX*b];
+  for (; b<=b1; b++)
+  {
+    if (b == b1)
+    {
+      mask &= 0xff >> (7-(y1%8));       // lower edge
+    }
+    NOKIA_fillspan(p, n, mask, mode);
+    mask = 0xff;
+    p += NOKIA_SIZEX;
+  }
+}
+
+/**
+ * @name NOKIA_invertrect
+ * @param x0, y0  one corner
+ * @param x1, y1  the opposite corner
+ * @return none
+ * @brief inverts a rectangle, e.g. a selected menu line; a second call
+ *        restores it
+ */
+void NOKIA_invertrect(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1)
+{
+  NOKIA_fillrect(x0, y0, x1, y1, NOKIA_DRAW_XOR);
+}
+
+/**
+ * @name NOKIA_hline
+ * @param x0  first column
+ * @param x1  last column
+ * @param y  row
+ * @param mode  NOKIA_DRAW_SET, NOKIA_DRAW_CLEAR or NOKIA_DRAW_XOR
+ * @return none
+ * @brief draws a horizontal line, one byte per column
+ */
+void NOKIA_hline(uint8_t x0, uint8_t x1, uint8_t y, uint8_t mode)
+{
+  NOKIA_fillrect(x0, y, x1, y, mode);
+}
+
+/**
+ * @name NOKIA_vline
+ * @param x  column
+ * @param y0  first row
+ * @param y1  last row
+ * @param mode  NOKIA_DRAW_SET, NOKIA_DRAW_CLEAR or NOKIA_DRAW_XOR
+ * @return none
+ * @brief draws a vertical line, one byte per bank
+ */
+void NOKIA_vline(uint8_t x, uint8_t y0, uint8_t y1, uint8_t mode)
+{
+  NOKIA_fillrect(x, y0, x, y1, mode);
+}
+
+/**
+ * @name NOKIA_line
+ * @param x0, y0  start point
+ * @param x1, y1  end point
+ * @param mode  NOKIA_DRAW_SET, NOKIA_DRAW_CLEAR or NOKIA_DRAW_XOR
+ * @return none
+ * @brief draws a line (Bresenham), horizontal and vertical lines use
+ *        NOKIA_hline()/NOKIA_vline()
+ */
+void NOKIA_line(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t mode)
+{
+  int16_t dx, dy, err, e2;
+  int8_t sx, sy;
+  int16_t x = x0, y = y0;
+
+  if (y0 == y1)
+  {
+    NOKIA_hline(x0, x1, y0, mode);
+    return;
+  }
+  if (x0 == x1)
+  {
+    NOKIA_vline(x0, y0, y1, mode);
+    return;
+  }
+  dx = abs((int16_t) x1-x0);
+  dy = -abs((int16_t) y1-y0);
+  sx = (x0 < x1) ? 1 : -1;
+  sy = (y0 < y1) ? 1 : -1;
+  err = dx+dy;
+  while (1)
+  {
+    NOKIA_plot(x, y, mode);
+    if ((x == x1) && (y == y1))
+    {
+      break;
+    }
+    e2 = 2*err;
+    if (e2 >= dy)
+    {
+      err += dy;
+      x += sx;
+    }
+    if (e2 <= dx)
+    {
+      err += dx;
+      y += sy;
+    }
+  }
+}
+
+/**
+ * @name NOKIA_rect
+ * @param x0, y0  one corner
+ * @param x1, y1  the opposite corner
+ * @param mode  NOKIA_DRAW_SET, NOKIA_DRAW_CLEAR or NOKIA_DRAW_XOR
+ * @return none
+ * @brief draws the outline of a rectangle, every pixel once
+ */
+void NOKIA_rect(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t mode)
+{
+  uint8_t t;
+
+  if (x0 > x1)
+  {
+    t = x0; x0 = x1; x1 = t;
+  }
+  if (y0 > y1)
+  {
+    t = y0; y0 = y1; y1 = t;
+  }
+  NOKIA_hline(x0, x1, y0, mode);
+  if (y1 == y0)
+  {
+    return;
+  }
+  NOKIA_hline(x0, x1, y1, mode);
+  if (y1-y0 < 2)
+  {
+    return;
+  }
+  NOKIA_vline(x0, y0+1, y1-1, mode);  // without the corners, for XOR
+  if (x1 != x0)
+  {
+    NOKIA_vline(x1, y0+1, y1-1, mode);
+  }
+}
+
+/**
+ * @name NOKIA_plot4
+ * @param xc, yc  center
+ * @param dx, dy  offset >= 0
+ * @param mode  NOKIA_DRAW_SET, NOKIA_DRAW_CLEAR or NOKIA_DRAW_XOR
+ * @return none
+ * @brief the points mirrored at the axes through the center, without
+ *        duplicates on the axes
+ */
+static void NOKIA_plot4(int16_t xc, int16_t yc, int16_t dx, int16_t dy, uint8_t mode)
+{
+  NOKIA_plot(xc+dx, yc+dy, mode);
+  if (dx != 0)
+  {
+    NOKIA_plot(xc-dx, yc+dy, mode);
+  }
+  if (dy != 0)
+  {
+    NOKIA_plot(xc+dx, yc-dy, mode);
+    if (dx != 0)
+    {
+      NOKIA_plot(xc-dx, yc-dy, mode);
+    }
+  }
+}
+
+/**
+ * @name NOKIA_circle
+ * @param xc, yc  center
+ * @param r  radius
+ * @param mode  NOKIA_DRAW_SET, NOKIA_DRAW_CLEAR or NOKIA_DRAW_XOR
+ * @return none
+ * @brief draws a circle (midpoint algorithm), every pixel once
+ */
+void NOKIA_circle(uint8_t xc, uint8_t yc, uint8_t r, uint8_t mode)
+{
+  int16_t x = 0, y = r, d = 1-r;
+
+  while (x <= y)
+  {
+    NOKIA_plot4(xc, yc, x, y, mode);
+    if (x != y)
+    {
+      NOKIA_plot4(xc, yc, y, x, mode);
+    }
+    x++;
+    if (d < 0)
+    {
+      d += 2*x+1;
+    }
+    else
+    {
+      y--;
+      d += 2*(x-y)+1;
+    }
+  }
+}
+
+/**
+ * @name NOKIA_fillcircle
+ * @param xc, yc  center
+ * @param r  radius
+ * @param mode  NOKIA_DRAW_SET, NOKIA_DRAW_CLEAR or NOKIA_DRAW_XOR
+ * @return none
+ * @brief fills a circle with one NOKIA_hline() per row
+ */
+void NOKIA_fillcircle(uint8_t xc, uint8_t yc, uint8_t r, uint8_t mode)
+{
+  int16_t dy, x = 0, x0, x1, y;
+  int16_t r2 = (int16_t) r*r+r;
+
+  for (dy=r; dy>=-(int16_t)r; dy--)
+  {
+    y = yc+dy;
+    if (dy >= 0)
+    {                                   // half width grows towards the center
+      while ((x+1)*(x+1)+dy*dy <= r2)
+      {
+        x++;
+      }
+    }
+    else
+    {
+      while (x*x+dy*dy > r2)
+      {
+        x--;
+      }
+    }
+    if ((y < 0) || (y >= NOKIA_SIZEY))
+    {
+      continue;
+    }
+    x0 = xc-x;
+    x1 = xc+x;
+    if ((x1 < 0) || (x0 >= NOKIA_SIZEX))
+    {
+      continue;
+    }
+    if (x0 < 0)
+    {
+      x0 = 0;
+    }
+    NOKIA_hline(x0, (x1 >= NOKIA_SIZEX) ? NOKIA_SIZEX-1 : x1, y, mode);
+  }
+}
+
+/**
+ * @name NOKIA_blitrows
+ * @param x, y  upper-left corner, may be outside of the display
+ * @param bitmap  rows of column bytes
+ * @param w  width in pixels
+ * @param h  height in pixels
+ * @param mode  NOKIA_DRAW_COPY, NOKIA_DRAW_SET, NOKIA_DRAW_CLEAR or
+ *              NOKIA_DRAW_XOR
+ * @param pgm  1 - bitmap in PROGMEM
+ * @return none
+ * @brief each bitmap byte is shifted into a 16 bit column with one
+ *        multiplication and merged into the two banks it covers, like
+ *        NOKIA_putchar(); with the column c and the pixels of the row w
+ *        all modes are   bank = (bank & ~clr) ^ flip
+ *        - COPY:    clr = w, flip = c
+ *        - SET:     clr = c, flip = c
+ *        - CLEAR:   clr = c, flip = 0
+ *        - XOR:     clr = 0, flip = c
+ */
+static inline void NOKIA_blitrows(int16_t x, int16_t y, const uint8_t *bitmap,
+                                  uint8_t w, uint8_t h, uint8_t mode, uint8_t pgm)
+{
+  int16_t x1, y1, dy;
+  uint8_t c0, n, r, rows, bits, shift, b, top, bottom, i;
+  uint16_t m, window, wclr, cclr, cflip, column, clr;
+  const uint8_t *s;
+
+  if ((w == 0) || (h == 0))
+  {
+    return;
+  }
+  x1 = x+w-1;
+  y1 = y+h-1;
+  if ((x1 < 0) || (y1 < 0) || (x >= NOKIA_SIZEX) || (y >= NOKIA_SIZEY))
+  {
+    return;
+  }
+  c0 = (x < 0) ? -x : 0;                // first visible column of the bitmap
+  if (x1 >= NOKIA_SIZEX)
+  {
+    x1 = NOKIA_SIZEX-1;
+  }
+  n = x1-(x+c0)+1;
+  NOKIA_markdirty(x+c0, x1, (y < 0) ? 0 : y,
+                  (y1 >= NOKIA_SIZEY) ? NOKIA_SIZEY-1 : y1);
+
+  cclr  = ((mode == NOKIA_DRAW_SET) || (mode == NOKIA_DRAW_CLEAR)) ? 0xffff : 0;
+  cflip = (mode == NOKIA_DRAW_CLEAR) ? 0 : 0xffff;
+  rows = (h+7)/8;
+  for (r=0; r<rows; r++)
+  {
+    dy = y+8*r;
+    if (dy <= -8)
+    {
+      continue;
+    }
+    if (dy >= NOKIA_SIZEY)
+    {
+      break;
+    }
+    bits = 0xff;
+    if ((r == rows-1) && (h%8))
+    {
+      bits >>= 8-h%8;                   // rows of the last bank
+    }
+    b = (dy+8)/8;                       // upper bank+1, dy may be -7..-1
+    shift = 1 << ((dy+8)%8);
+    window = bits*shift;
+    top    = (b > 0) && (window & 0xff);
+    bottom = (b < NOKIA_BANKS) && (window >> 8);
+    wclr = (mode == NOKIA_DRAW_COPY) ? window : 0;
+    m = (uint16_t) x+c0+NOKIA_SIZEX*b;  // lower bank
+    s = &bitmap[(uint16_t) r*w+c0];
+    for (i=0; i<n; i++)
+    {
+      column = (uint8_t) ((pgm ? pgm_read_byte(s) : *s) & bits)*shift;
+      s++;
+      clr = wclr | (column & cclr);
+      column &= cflip;
+      if (top)
+      {
+        NOKIA_FRAMEBUFFER[m-NOKIA_SIZEX] &= ~clr;
+        NOKIA_FRAMEBUFFER[m-NOKIA_SIZEX] ^= column;
+      }
+      if (bottom)
+      {
+        NOKIA_FRAMEBUFFER[m] &= ~(clr >> 8);
+        NOKIA_FRAMEBUFFER[m] ^= column >> 8;
+      }
+      m++;
+    }
+  }
+}
+
+/**
+ * @name NOKIA_blit
+ * @param x, y  upper-left corner, may be outside of the display
+ * @param bitmap  bitmap in RAM or in flash mapped into the data space
+ * @param w  width in pixels
+ * @param h  height in pixels
+ * @param mode  NOKIA_DRAW_COPY, NOKIA_DRAW_SET, NOKIA_DRAW_CLEAR or
+ *              NOKIA_DRAW_XOR
+ * @return none
+ * @brief draws a bitmap, clipped at the border of the display
+ */
+void NOKIA_blit(int16_t x, int16_t y, const uint8_t *bitmap, uint8_t w, uint8_t h, uint8_t mode)
+{
+  NOKIA_blitrows(x, y, bitmap, w, h, mode, 0);
+}
+
+/**
+ * @name NOKIA_blit_P
+ * @param x, y  upper-left corner, may be outside of the display
+ * @param bitmap  bitmap in PROGMEM
+ * @param w  width in pixels
+ * @param h  height in pixels
+ * @param mode  NOKIA_DRAW_COPY, NOKIA_DRAW_SET, NOKIA_DRAW_CLEAR or
+ *              NOKIA_DRAW_XOR
+ * @return none
+ * @brief draws a bitmap from PROGMEM, clipped at the border of the display
+ */
+void NOKIA_blit_P(int16_t x, int16_t y, const uint8_t *bitmap, uint8_t w, uint8_t h, uint8_t mode)
+{
+  NOKIA_blitrows(x, y, bitmap, w, h, mode, 1);
+}
@@ -0,0 +1,151 @@
+/**
+ * @file nokia5110_gfx.h
+ * @brief graphics primitives for the Nokia 5110 driver
+ *
+ * @author Uwe Zimmermann
+ *
+ * The library work is licensed under a MIT license.\n
+ * See https://github.com/uwezi/AVR-Dx
+ *
+ * Lines, rectangles and circles in the framebuffer. Horizontal and vertical
+ * lines and filled rectangles are written as whole bank bytes with masks for
+ * the upper and lower edge, a filled rectangle of 84x48 pixels costs 504
+ * byte operations instead of 4032 pixels. All functions clip at the border
+ * of the display and mark the changed area for NOKIA_update().
+ *
+ * Bitmaps for NOKIA_blit() are stored like the fonts: rows of 8 pixels, each
+ * row w column bytes with the top pixel in bit 0; a bitmap of w x h pixels
+ * has (h+7)/8 rows. A 8x8 arrow:
+ *
+ *   const uint8_t arrow[] PROGMEM = {0x00, 0x18, 0x3c, 0x7e, 0xff, 0x18, 0x18, 0x18};
+ *   NOKIA_blit_P(x, y, arrow, 8, 8, NOKIA_DRAW_XOR);  // draw
+ *   NOKIA_blit_P(x, y, arrow, 8, 8, NOKIA_DRAW_XOR);  // and remove again
+ *
+ * ChangeLog:
+ * --------
+ * * 2026-10-18 created
+ * * 2026-10-18 bitmaps with NOKIA_blit(), NOKIA_blit_P()
+ */
+#ifndef NOKIA5110_GFX_H_
+#define NOKIA5110_GFX_H_
+
+#include <nokia5110.h>
+
+/**
+ * drawing modes
+ */
+#define NOKIA_DRAW_SET   0 //!< pixels on (bitmaps: OR)
+#define NOKIA_DRAW_CLEAR 1 //!< pixels off (bitmaps: AND-NOT)
+#define NOKIA_DRAW_XOR   2 //!< pixels inverted, drawing twice restores the background
+#define NOKIA_DRAW_COPY  3 //!< bitmaps: replace the background, otherwise as NOKIA_DRAW_SET
+
+/**
+ * @name NOKIA_hline
+ * @param x0  first column
+ * @param x1  last column
+ * @param y  row
+ * @param mode  NOKIA_DRAW_SET, NOKIA_DRAW_CLEAR or NOKIA_DRAW_XOR
+ * @return none
+ * @brief draws a horizontal line, one byte per column
+ */
+void NOKIA_hline(uint8_t x0, uint8_t x1, uint8_t y, uint8_t mode);
+
+/**
+ * @name NOKIA_vline
+ * @param x  column
+ * @param y0  first row
+ * @param y1  last row
+ * @param mode  NOKIA_DRAW_SET, NOKIA_DRAW_CLEAR or NOKIA_DRAW_XOR
+ * @return none
+ * @brief draws a vertical line, one byte per bank
+ */
+void NOKIA_vline(uint8_t x, uint8_t y0, uint8_t y1, uint8_t mode);
+
+/**
+ * @name NOKIA_line
+ * @param x0, y0  start point
+ * @param x1, y1  end point
+ * @param mode  NOKIA_DRAW_SET, NOKIA_DRAW_CLEAR or NOKIA_DRAW_XOR
+ * @return none
+ * @brief draws a line (Bresenham), horizontal and vertical lines use
+ *        NOKIA_hline()/NOKIA_vline()
+ */
+void NOKIA_line(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t mode);
+
+/**
+ * @name NOKIA_rect
+ * @param x0, y0  one corner
+ * @param x1, y1  the opposite corner
+ * @param mode  NOKIA_DRAW_SET, NOKIA_DRAW_CLEAR or NOKIA_DRAW_XOR
+ * @return none
+ * @brief draws the outline of a rectangle, every pixel once
+ */
+void NOKIA_rect(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t mode);
+
+/**
+ * @name NOKIA_fillrect
+ * @param x0, y0  one corner
+ * @param x1, y1  the opposite corner
+ * @param mode  NOKIA_DRAW_SET, NOKIA_DRAW_CLEAR or NOKIA_DRAW_XOR
+ * @return none
+ * @brief fills a rectangle bank by bank
+ */
+void NOKIA_fillrect(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t mode);
+
+/**
+ * @name NOKIA_invertrect
+ * @param x0, y0  one corner
+ * @param x1, y1  the opposite corner
+ * @return none
+ * @brief inverts a rectangle, e.g. a selected menu line; a second call
+ *        restores it
+ */
+void NOKIA_invertrect(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1);
+
+/**
+ * @name NOKIA_circle
+ * @param xc, yc  center
+ * @param r  radius
+ * @param mode  NOKIA_DRAW_SET, NOKIA_DRAW_CLEAR or NOKIA_DRAW_XOR
+ * @return none
+ * @brief draws a circle (midpoint algorithm), every pixel once
+ */
+void NOKIA_circle(uint8_t xc, uint8_t yc, uint8_t r, uint8_t mode);
+
+/**
+ * @name NOKIA_fillcircle
+ * @param xc, yc  center
+ * @param r  radius
+ * @param mode  NOKIA_DRAW_SET, NOKIA_DRAW_CLEAR or NOKIA_DRAW_XOR
+ * @return none
+ * @brief fills a circle with one NOKIA_hline() per row
+ */
+void NOKIA_fillcircle(uint8_t xc, uint8_t yc, uint8_t r, uint8_t mode);
+
+/**
+ * @name NOKIA_blit
+ * @param x, y  upper-left corner, may be outside of the display
+ * @param bitmap  bitmap in RAM or in flash mapped into the data space
+ * @param w  width in pixels
+ * @param h  height in pixels
+ * @param mode  NOKIA_DRAW_COPY, NOKIA_DRAW_SET, NOKIA_DRAW_CLEAR or
+ *              NOKIA_DRAW_XOR
+ * @return none
+ * @brief draws a bitmap, clipped at the border of the display
+ */
+void NOKIA_blit(int16_t x, int16_t y, const uint8_t *bitmap, uint8_t w, uint8_t h, uint8_t mode);
+
+/**
+ * @name NOKIA_blit_P
+ * @param x, y  upper-left corner, may be outside of the display
+ * @param bitmap  bitmap in PROGMEM
+ * @param w  width in pixels
+ * @param h  height in pixels
+ * @param mode  NOKIA_DRAW_COPY, NOKIA_DRAW_SET, NOKIA_DRAW_CLEAR or
+ *              NOKIA_DRAW_XOR
+ * @return none
+ * @brief draws a bitmap from PROGMEM, clipped at the border of the display
+ */
+void NOKIA_blit_P(int16_t x, int16_t y, const uint8_t *bitmap, uint8_t w, uint8_t h, uint8_t mode);
+
+#endif /* NOKIA5110_GFX_H_ */
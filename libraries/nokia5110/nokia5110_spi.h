@@ -0,0 +1,107 @@
+/**
+ * @file nokia5110_spi.h
+ * @brief hardware SPI transport of the Nokia 5110 driver
+ *
+ * @author Uwe Zimmermann
+ *
+ * The library work is licensed under a MIT license.\n
+ * See https://github.com/uwezi/AVR-Dx
+ *
+ * Included by nokia5110.c only: register access of the SPI in buffered mode
+ * for nokia5110_buffered.h and the interrupt of NOKIA_updateAsync().
+ *
+ * ChangeLog:
+ * --------
+ * * 2025-12-06 hardware SPI0
+ * * 2026-10-18 created from nokia5110_hspi.c
+ */
+#ifndef NOKIA5110_SPI_H_
+#define NOKIA5110_SPI_H_
+
+/**
+ * @name NOKIA_portInit
+ * @brief host mode, mode 0, MSB first, buffered; the SCK and MOSI pins need
+ *        to be outputs
+ */
+static inline void NOKIA_portInit(void)
+{
+  NOKIA_SPI.CTRLA = SPI_MASTER_bm | NOKIA_SPI_PRESC;
+  NOKIA_SPI.CTRLB = SPI_MODE_0_gc | SPI_SSD_bm | SPI_BUFEN_bm | SPI_BUFWR_bm;
+  NOKIA_SPI.CTRLA |= SPI_ENABLE_bm;
+}
+
+/**
+ * @brief TX buffer empty / last byte shifted out
+ */
+static inline uint8_t NOKIA_txReady(void)
+{
+  return NOKIA_SPI.INTFLAGS & SPI_DREIF_bm;
+}
+
+static inline uint8_t NOKIA_txDone(void)
+{
+  return NOKIA_SPI.INTFLAGS & SPI_TXCIF_bm;
+}
+
+/**
+ * @name NOKIA_txPut
+ * @param data  byte to be sent
+ * @brief writes into the TX buffer without waiting, TXCIF is cleared for
+ *        NOKIA_flush()
+ * @note two stores, call with disabled interrupts (see NOKIA_send())
+ */
+static inline void NOKIA_txPut(uint8_t data)
+{
+  NOKIA_SPI.DATA = data;
+  NOKIA_SPI.INTFLAGS = SPI_TXCIF_bm;
+}
+
+/**
+ * @brief bit order, 1 - LSB first
+ */
+static inline uint8_t NOKIA_txLSB(void)
+{
+  return (NOKIA_SPI.CTRLA & SPI_DORD_bm) ? 1 : 0;
+}
+
+static inline void NOKIA_txToggleOrder(void)
+{
+  NOKIA_SPI.CTRLA ^= SPI_DORD_bm;
+}
+
+/**
+ * @brief interrupt for NOKIA_updateAsync(): room in the TX buffer, all bytes
+ *        sent, none
+ */
+static inline void NOKIA_irqData(void)
+{
+  NOKIA_SPI.INTCTRL = SPI_DREIE_bm;
+}
+
+static inline void NOKIA_irqComplete(void)
+{
+  NOKIA_SPI.INTCTRL = SPI_TXCIE_bm;
+}
+
+static inline void NOKIA_irqOff(void)
+{
+  NOKIA_SPI.INTCTRL = 0;
+}
+
+/**
+ * @brief DREIE: room in the TX buffer for NOKIA_updateAsync()
+ *        TXCIE: all bytes sent, DC can be switched or the transfer ends
+ */
+ISR(NOKIA_SPI_INTVEC)
+{
+  if (NOKIA_SPI.INTCTRL & SPI_TXCIE_bm)
+  {
+    NOKIA_asyncComplete();
+  }
+  else
+  {
+    NOKIA_asyncNext();
+  }
+}
+
+#endif /* NOKIA5110_SPI_H_ */
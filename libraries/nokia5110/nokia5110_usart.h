@@ -0,0 +1,108 @@
+/**
+ * @file nokia5110_usart.h
+ * @brief USART transport of the Nokia 5110 driver, host SPI mode (MSPI)
+ *
+ * @author Uwe Zimmermann
+ *
+ * The library work is licensed under a MIT license.\n
+ * See https://github.com/uwezi/AVR-Dx
+ *
+ * Included by nokia5110.c only: register access of a USART in host SPI mode
+ * for nokia5110_buffered.h and the interrupts of NOKIA_updateAsync().
+ *
+ * ChangeLog:
+ * --------
+ * * 2026-10-18 created from nokia5110_hspi.c and its USART transport
+ */
+#ifndef NOKIA5110_USART_H_
+#define NOKIA5110_USART_H_
+
+/**
+ * @name NOKIA_portInit
+ * @brief host SPI mode 0, MSB first, transmitter only; the XCK and TXD pins
+ *        need to be outputs
+ */
+static inline void NOKIA_portInit(void)
+{
+  NOKIA_USART.CTRLA = 0;
+  NOKIA_USART.BAUD = NOKIA_USPI_BAUD;
+  NOKIA_USART.CTRLC = USART_CMODE_MSPI_gc;
+  NOKIA_USART.CTRLB = USART_TXEN_bm;
+  NOKIA_USART.STATUS = USART_TXCIF_bm;
+}
+
+/**
+ * @brief TX buffer empty / last byte shifted out
+ */
+static inline uint8_t NOKIA_txReady(void)
+{
+  return NOKIA_USART.STATUS & USART_DREIF_bm;
+}
+
+static inline uint8_t NOKIA_txDone(void)
+{
+  return NOKIA_USART.STATUS & USART_TXCIF_bm;
+}
+
+/**
+ * @name NOKIA_txPut
+ * @param data  byte to be sent
+ * @brief writes into the TX buffer without waiting, TXCIF is cleared for
+ *        NOKIA_flush()
+ * @note two stores, call with disabled interrupts (see NOKIA_send())
+ */
+static inline void NOKIA_txPut(uint8_t data)
+{
+  NOKIA_USART.TXDATAL = data;
+  NOKIA_USART.STATUS = USART_TXCIF_bm;
+}
+
+/**
+ * @brief bit order, 1 - LSB first
+ */
+static inline uint8_t NOKIA_txLSB(void)
+{
+  return (NOKIA_USART.CTRLC & USART_UDORD_bm) ? 1 : 0;
+}
+
+static inline void NOKIA_txToggleOrder(void)
+{
+  NOKIA_USART.CTRLC ^= USART_UDORD_bm;
+}
+
+/**
+ * @brief interrupt for NOKIA_updateAsync(): room in the TX buffer, all bytes
+ *        sent, none
+ */
+static inline void NOKIA_irqData(void)
+{
+  NOKIA_USART.CTRLA = USART_DREIE_bm;
+}
+
+static inline void NOKIA_irqComplete(void)
+{
+  NOKIA_USART.CTRLA = USART_TXCIE_bm;
+}
+
+static inline void NOKIA_irqOff(void)
+{
+  NOKIA_USART.CTRLA = 0;
+}
+
+/**
+ * @brief room in the TX buffer for NOKIA_updateAsync()
+ */
+ISR(NOKIA_USART_DREVEC)
+{
+  NOKIA_asyncNext();
+}
+
+/**
+ * @brief all bytes sent, DC can be switched or the transfer ends
+ */
+ISR(NOKIA_USART_TXCVEC)
+{
+  NOKIA_asyncComplete();
+}
+
+#endif /* NOKIA5110_USART_H_ */
@@ -1,278 +0,0 @@
-/**
- * @file font_6x8_iso8859_1
- * @brief 6x8 pixel font
- *
- * @author Uwe Zimmermann
- *
- * The library work is licensed under a MIT license.\n
- * See https://github.com/uwezi/AVR-Dx
- *
- * ChangeLog:
- * --------
- * * 2015-06-09 originally created
- * * 2025-1020 ported to .h file
- */
-#ifndef FONT_6X8_ISO8859_1_H_
-#define FONT_6X8_ISO8859_1_H_
-
-static const uint8_t smallFont[][6] PROGMEM =
-{ // 6x8 font
-  {0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, // 0x00 level 1-1
-  {0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0}, // 0x01 level 1-2
-  {0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0}, // 0x02 level 1-3
-  {0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0}, // 0x03 level 1-4
-  {0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8}, // 0x04 level 1-5
-  {0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC}, // 0x05 level 1-6
-  {0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE}, // 0x06 level 1-7
-  {0x04, 0x06, 0x7F, 0x06, 0x04, 0x00}, // 0x07 arrow up
-  {0x10, 0x30, 0x7F, 0x30, 0x10, 0x00}, // 0x08 arrow down
-  {0x08, 0x08, 0x08, 0x3E, 0x1C, 0x08}, // 0x09 arrow right
-  {0x08, 0x1C, 0x3E, 0x08, 0x08, 0x08}, // 0x0a arrow left
-  {0x50, 0x58, 0x54, 0x52, 0x51, 0x00}, // 0x0b &le;
-  {0x51, 0x52, 0x54, 0x58, 0x50, 0x00}, // 0x0c &ge;
-  {0x60, 0x58, 0x46, 0x58, 0x60, 0x00}, // 0x0d Delta
-  {0x41, 0x63, 0x55, 0x49, 0x41, 0x00}, // 0x0e Sigma
-  {0x4E, 0x71, 0x01, 0x71, 0x4E, 0x00}, // 0x0f Omega
-  {0xFF, 0x00, 0x00, 0x00, 0x00, 0x00}, // 0x10 bar 1-1
-  {0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00}, // 0x11 bar 1-2
-  {0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00}, // 0x12 bar 1-3
-  {0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00}, // 0x13 bar 1-4
-  {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00}, // 0x14 bar 1-5
-  {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}, // 0x15 bar 1-6
-  {0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}, // 0x16 bar 2-6
-  {0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF}, // 0x17 bar 3-6
-  {0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF}, // 0x18 bar 5-6
-  {0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF}, // 0x19 bar 5-6
-  {0x00, 0x00, 0x00, 0x00, 0x00, 0xFF}, // 0x1a bar 6-6
-  {0x20, 0x3E, 0xBF, 0x3E, 0x20, 0x00}, // 0x1b sound
-  {0x04, 0x0C, 0x1C, 0x0C, 0x04, 0x00}, // 0x1c down
-  {0x00, 0x3E, 0x1C, 0x08, 0x00, 0x00}, // 0x1d right
-  {0x00, 0x08, 0x1C, 0x3E, 0x00, 0x00}, // 0x1e left
-  {0x10, 0x18, 0x1C, 0x18, 0x10, 0x00}, // 0x1f up
-  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // 0x20 sp
-  {0x00, 0x00, 0x4F, 0x00, 0x00, 0x00}, // 0x21 !
-  {0x00, 0x07, 0x00, 0x07, 0x00, 0x00}, // 0x22 "
-  {0x14, 0x7F, 0x14, 0x7F, 0x14, 0x00}, // 0x23 #
-  {0x24, 0x2A, 0x7F, 0x2A, 0x12, 0x00}, // 0x24 $
-  {0x23, 0x13, 0x08, 0x64, 0x62, 0x00}, // 0x25 %
-  {0x36, 0x49, 0x55, 0x22, 0x50, 0x00}, // 0x26 &
-  {0x00, 0x05, 0x03, 0x00, 0x00, 0x00}, // 0x27 '
-  {0x00, 0x1C, 0x22, 0x41, 0x00, 0x00}, // 0x28 (
-  {0x00, 0x41, 0x22, 0x1C, 0x00, 0x00}, // 0x29 )
-  {0x14, 0x08, 0x3E, 0x08, 0x14, 0x00}, // 0x2a *
-  {0x08, 0x08, 0x3E, 0x08, 0x08, 0x00}, // 0x2b +
-  {0x00, 0xA0, 0x60, 0x00, 0x00, 0x00}, // 0x2c ,
-  {0x10, 0x10, 0x10, 0x10, 0x10, 0x00}, // 0x2d -
-  {0x00, 0x60, 0x60, 0x00, 0x00, 0x00}, // 0x2e .
-  {0x20, 0x10, 0x08, 0x04, 0x02, 0x00}, // 0x2f /
-  {0x3E, 0x41, 0x49, 0x41, 0x3E, 0x00}, // 0x30 0
-  {0x00, 0x42, 0x7F, 0x40, 0x00, 0x00}, // 0x31 1
-  {0x42, 0x61, 0x51, 0x49, 0x46, 0x00}, // 0x32 2
-  {0x21, 0x41, 0x45, 0x4B, 0x31, 0x00}, // 0x33 3
-  {0x18, 0x14, 0x12, 0x7F, 0x10, 0x00}, // 0x34 4
-  {0x27, 0x45, 0x45, 0x45, 0x39, 0x00}, // 0x35 5
-  {0x3C, 0x4A, 0x49, 0x49, 0x30, 0x00}, // 0x36 6
-  {0x01, 0x71, 0x09, 0x05, 0x03, 0x00}, // 0x37 7
-  {0x36, 0x49, 0x49, 0x49, 0x36, 0x00}, // 0x38 8
-  {0x06, 0x49, 0x49, 0x29, 0x1E, 0x00}, // 0x39 9
-  {0x00, 0x66, 0x66, 0x00, 0x00, 0x00}, // 0x3a :
-  {0x00, 0xA6, 0x66, 0x00, 0x00, 0x00}, // 0x3b ;
-  {0x08, 0x14, 0x22, 0x41, 0x00, 0x00}, // 0x3c <
-  {0x14, 0x14, 0x14, 0x14, 0x14, 0x00}, // 0x3d =
-  {0x00, 0x41, 0x22, 0x14, 0x08, 0x00}, // 0x3e >
-  {0x02, 0x01, 0x51, 0x09, 0x06, 0x00}, // 0x3f ?
-  {0x32, 0x49, 0x59, 0x51, 0x3E, 0x00}, // 0x40 @
-  {0x7E, 0x09, 0x09, 0x09, 0x7E, 0x00}, // 0x41 A
-  {0x7F, 0x49, 0x49, 0x49, 0x36, 0x00}, // 0x42 B
-  {0x3E, 0x41, 0x41, 0x41, 0x22, 0x00}, // 0x43 C
-  {0x7F, 0x41, 0x41, 0x22, 0x1C, 0x00}, // 0x44 D
-  {0x7F, 0x49, 0x49, 0x49, 0x41, 0x00}, // 0x45 E
-  {0x7F, 0x09, 0x09, 0x09, 0x01, 0x00}, // 0x46 F
-  {0x3E, 0x41, 0x49, 0x49, 0x7A, 0x00}, // 0x47 G
-  {0x7F, 0x08, 0x08, 0x08, 0x7F, 0x00}, // 0x48 H
-  {0x00, 0x41, 0x7F, 0x41, 0x00, 0x00}, // 0x49 I
-  {0x20, 0x40, 0x41, 0x3F, 0x01, 0x00}, // 0x4a J
-  {0x7F, 0x08, 0x14, 0x22, 0x41, 0x00}, // 0x4b K
-  {0x7F, 0x40, 0x40, 0x40, 0x40, 0x00}, // 0x4c L
-  {0x7F, 0x02, 0x0C, 0x02, 0x7F, 0x00}, // 0x4d M
-  {0x7F, 0x04, 0x08, 0x10, 0x7F, 0x00}, // 0x4e N
-  {0x3E, 0x41, 0x41, 0x41, 0x3E, 0x00}, // 0x4f O
-  {0x7F, 0x09, 0x09, 0x09, 0x06, 0x00}, // 0x50 P
-  {0x3E, 0x41, 0x51, 0x21, 0x5E, 0x00}, // 0x51 Q
-  {0x7F, 0x09, 0x19, 0x29, 0x46, 0x00}, // 0x52 R
-  {0x46, 0x49, 0x49, 0x49, 0x31, 0x00}, // 0x53 S
-  {0x01, 0x01, 0x7F, 0x01, 0x01, 0x00}, // 0x54 T
-  {0x3F, 0x40, 0x40, 0x40, 0x3F, 0x00}, // 0x55 U
-  {0x1F, 0x20, 0x40, 0x20, 0x1F, 0x00}, // 0x56 V
-  {0x3F, 0x40, 0x38, 0x40, 0x3F, 0x00}, // 0x57 W
-  {0x63, 0x14, 0x08, 0x14, 0x63, 0x00}, // 0x58 X
-  {0x07, 0x08, 0x70, 0x08, 0x07, 0x00}, // 0x59 Y
-  {0x61, 0x51, 0x49, 0x45, 0x43, 0x00}, // 0x5a Z
-  {0x00, 0x7F, 0x41, 0x41, 0x00, 0x00}, // 0x5b [
-  {0x02, 0x04, 0x08, 0x10, 0x20, 0x00}, // 0x5c backslash
-  {0x00, 0x41, 0x41, 0x7F, 0x00, 0x00}, // 0x5d ]
-  {0x04, 0x02, 0x01, 0x02, 0x04, 0x00}, // 0x5e ^
-  {0x40, 0x40, 0x40, 0x40, 0x40, 0x40}, // 0x5f _
-  {0x00, 0x01, 0x02, 0x04, 0x00, 0x00}, // 0x60 '
-  {0x20, 0x54, 0x54, 0x54, 0x78, 0x00}, // 0x61 a
-  {0x7F, 0x48, 0x44, 0x44, 0x38, 0x00}, // 0x62 b
-  {0x38, 0x44, 0x44, 0x44, 0x20, 0x00}, // 0x63 c
-  {0x38, 0x44, 0x44, 0x48, 0x7F, 0x00}, // 0x64 d
-  {0x38, 0x54, 0x54, 0x54, 0x18, 0x00}, // 0x65 e
-  {0x08, 0x7E, 0x09, 0x01, 0x02, 0x00}, // 0x66 f
-  {0x18, 0xA4, 0xA4, 0xA4, 0x7C, 0x00}, // 0x67 g
-  {0x7F, 0x08, 0x04, 0x04, 0x78, 0x00}, // 0x68 h
-  {0x00, 0x44, 0x7D, 0x40, 0x00, 0x00}, // 0x69 i
-  {0x40, 0x80, 0x84, 0x7D, 0x00, 0x00}, // 0x6a j
-  {0x7F, 0x10, 0x28, 0x44, 0x00, 0x00}, // 0x6b k
-  {0x00, 0x41, 0x7F, 0x40, 0x00, 0x00}, // 0x6c l
-  {0x7C, 0x04, 0x18, 0x04, 0x78, 0x00}, // 0x6d m
-  {0x7C, 0x08, 0x04, 0x04, 0x78, 0x00}, // 0x6e n
-  {0x38, 0x44, 0x44, 0x44, 0x38, 0x00}, // 0x6f o
-  {0xFC, 0x24, 0x24, 0x24, 0x18, 0x00}, // 0x70 p
-  {0x18, 0x24, 0x24, 0x28, 0xFC, 0x00}, // 0x71 q
-  {0x7C, 0x08, 0x04, 0x04, 0x08, 0x00}, // 0x72 r
-  {0x48, 0x54, 0x54, 0x54, 0x24, 0x00}, // 0x73 s
-  {0x04, 0x3F, 0x44, 0x40, 0x20, 0x00}, // 0x74 t
-  {0x3C, 0x40, 0x40, 0x20, 0x7C, 0x00}, // 0x75 u
-  {0x1C, 0x20, 0x40, 0x20, 0x1C, 0x00}, // 0x76 v
-  {0x3C, 0x40, 0x30, 0x40, 0x3C, 0x00}, // 0x77 w
-  {0x44, 0x28, 0x10, 0x28, 0x44, 0x00}, // 0x78 x
-  {0x1C, 0xA0, 0xA0, 0xA0, 0x7C, 0x00}, // 0x79 y
-  {0x44, 0x64, 0x54, 0x4C, 0x44, 0x00}, // 0x7a z
-  {0x08, 0x36, 0x41, 0x41, 0x00, 0x00}, // 0x7b {
-  {0x00, 0x00, 0x7F, 0x00, 0x00, 0x00}, // 0x7c |
-  {0x00, 0x41, 0x41, 0x36, 0x08, 0x00}, // 0x7d }
-  {0x08, 0x04, 0x0C, 0x08, 0x04, 0x00}, // 0x7e ~
-  {0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55}, // 0x7f &nbsp;
-  {0x7C, 0x12, 0x11, 0x12, 0x7C, 0x00}, // 0x80 cyr A
-  {0x7F, 0x49, 0x49, 0x49, 0x30, 0x00}, // 0x81 cyr B
-  {0x7F, 0x49, 0x49, 0x49, 0x36, 0x00}, // 0x82 cyr W
-  {0x7F, 0x01, 0x01, 0x01, 0x01, 0x00}, // 0x83 cyr G
-  {0x60, 0x30, 0x2F, 0x21, 0x7F, 0x00}, // 0x84 cyr D
-  {0x7F, 0x49, 0x49, 0x49, 0x41, 0x00}, // 0x85 cyr Ye
-  {0x77, 0x08, 0x7F, 0x08, 0x77, 0x00}, // 0x86 cyr Zh
-  {0x22, 0x41, 0x49, 0x49, 0x36, 0x00}, // 0x87 cyr Z
-  {0x7F, 0x10, 0x08, 0x04, 0x7F, 0x00}, // 0x88 cyr I
-  {0x7D, 0x22, 0x12, 0x0A, 0x7D, 0x00}, // 0x89 cyr J
-  {0x7F, 0x08, 0x14, 0x22, 0x41, 0x00}, // 0x8a cyr K
-  {0x40, 0x3F, 0x01, 0x01, 0x7F, 0x00}, // 0x8b cyr L
-  {0x7F, 0x02, 0x0C, 0x02, 0x7F, 0x00}, // 0x8c cyr M
-  {0x7F, 0x08, 0x08, 0x08, 0x7F, 0x00}, // 0x8d cyr N
-  {0x3E, 0x41, 0x41, 0x41, 0x3E, 0x00}, // 0x8e cyr O
-  {0x7F, 0x01, 0x01, 0x01, 0x7F, 0x00}, // 0x8f cyr P
-  {0x7F, 0x09, 0x09, 0x09, 0x06, 0x00}, // 0x90 cyr R
-  {0x3E, 0x41, 0x41, 0x41, 0x22, 0x00}, // 0x91 cyr S
-  {0x01, 0x01, 0x7F, 0x01, 0x01, 0x00}, // 0x92 cyr T
-  {0x43, 0x4C, 0x30, 0x0C, 0x03, 0x00}, // 0x93 cyr U
-  {0x1C, 0x22, 0x7F, 0x22, 0x1C, 0x00}, // 0x94 cyr F
-  {0x63, 0x14, 0x08, 0x14, 0x63, 0x00}, // 0x95 cyr X
-  {0x7F, 0x40, 0x40, 0x7F, 0xC0, 0x00}, // 0x96 cyr Z
-  {0x07, 0x08, 0x08, 0x08, 0x7F, 0x00}, // 0x97 cyr Ch
-  {0x7F, 0x40, 0x7F, 0x40, 0x7F, 0x00}, // 0x98 cyr Sch
-  {0x3F, 0x20, 0x3F, 0x20, 0xFF, 0x00}, // 0x99 cyr Shh
-  {0x01, 0x7F, 0x48, 0x48, 0x30, 0x00}, // 0x9a cyr _
-  {0x7F, 0x48, 0x70, 0x00, 0x7F, 0x00}, // 0x9b cyr Y
-  {0x7F, 0x48, 0x48, 0x48, 0x30, 0x00}, // 0x9c cyr '
-  {0x22, 0x49, 0x49, 0x49, 0x3E, 0x00}, // 0x9d cyr E
-  {0x7F, 0x08, 0x3E, 0x41, 0x3E, 0x00}, // 0x9e cyr Yu
-  {0x46, 0x29, 0x19, 0x09, 0x7F, 0x00}, // 0x9f cyr Ya
-  {0x7C, 0x55, 0x54, 0x55, 0x44, 0x00}, // 0xa0 cyr Yo
-  {0x00, 0x00, 0x79, 0x00, 0x00, 0x00}, // 0xa1 &iexcl;
-  {0x14, 0x3E, 0x55, 0x55, 0x41, 0x00}, // 0xa2 &euro;
-  {0x48, 0x7E, 0x49, 0x49, 0x42, 0x00}, // 0xa3 &pound;
-  {0x5D, 0x22, 0x22, 0x22, 0x5D, 0x00}, // 0xa4 &curren;
-  {0x29, 0x2A, 0x7C, 0x2A, 0x29, 0x00}, // 0xa5 &yen;
-  {0x00, 0x00, 0x77, 0x00, 0x00, 0x00}, // 0xa6 &brvbar;
-  {0x0A, 0x55, 0x55, 0x55, 0x28, 0x00}, // 0xa7 &sect;
-  {0x00, 0x01, 0x00, 0x01, 0x00, 0x00}, // 0xa8 &uml;
-  {0x42, 0xBD, 0xA5, 0x81, 0x7E, 0x00}, // 0xa9 &copy;
-  {0x48, 0x55, 0x55, 0x55, 0x5E, 0x00}, // 0xaa &ordf;
-  {0x08, 0x14, 0x2A, 0x14, 0x22, 0x00}, // 0xab &laquo;
-  {0x08, 0x08, 0x08, 0x08, 0x38, 0x00}, // 0xac &not;
-  {0x00, 0x08, 0x08, 0x08, 0x00, 0x00}, // 0xad &shy;
-  {0x42, 0xBD, 0x95, 0xA9, 0x7E, 0x00}, // 0xae &reg;
-  {0x01, 0x01, 0x01, 0x01, 0x01, 0x00}, // 0xaf &macr;
-  {0x06, 0x09, 0x09, 0x06, 0x00, 0x00}, // 0xb0 &deg;
-  {0x44, 0x44, 0x5F, 0x44, 0x44, 0x00}, // 0xb1 &plusmn;
-  {0x19, 0x15, 0x15, 0x12, 0x00, 0x00}, // 0xb2 &sup2;
-  {0x11, 0x15, 0x15, 0x0A, 0x00, 0x00}, // 0xb3 &sup3;
-  {0x00, 0x00, 0x02, 0x01, 0x00, 0x00}, // 0xb4 &acute;
-  {0xF8, 0x40, 0x40, 0x38, 0x40, 0x00}, // 0xb5 &micro;
-  {0x06, 0x09, 0x7F, 0x01, 0x7F, 0x00}, // 0xb6 &para;
-  {0x00, 0x18, 0x18, 0x00, 0x00, 0x00}, // 0xb7 &middot;
-  {0x00, 0x80, 0x80, 0xC0, 0x00, 0x00}, // 0xb8 &cedit;
-  {0x12, 0x1F, 0x10, 0x00, 0x00, 0x00}, // 0xb9 &sup1;
-  {0x4E, 0x51, 0x51, 0x51, 0x4E, 0x00}, // 0xba &ordm;
-  {0x22, 0x14, 0x2A, 0x14, 0x08, 0x00}, // 0xbb &raquo;
-  {0x10, 0x0F, 0x64, 0x52, 0xF9, 0x00}, // 0xbc &frac14;
-  {0x10, 0x0F, 0xD4, 0xAA, 0x99, 0x00}, // 0xbd &frac12;
-  {0x35, 0x1F, 0x64, 0x52, 0xF9, 0x00}, // 0xbe &frac34;
-  {0x30, 0x48, 0x45, 0x40, 0x20, 0x00}, // 0xbf &iquest;
-  {0x78, 0x15, 0x16, 0x14, 0x78, 0x00}, // 0xc0 &Agrave;
-  {0x78, 0x14, 0x16, 0x15, 0x78, 0x00}, // 0xc1 &Aacute;
-  {0x78, 0x16, 0x15, 0x16, 0x78, 0x00}, // 0xc2 &Acirc;
-  {0x72, 0x29, 0x2A, 0x2A, 0x71, 0x00}, // 0xc3 &Atilde;
-  {0x78, 0x15, 0x14, 0x15, 0x78, 0x00}, // 0xc4 &Auml;
-  {0x78, 0x17, 0x15, 0x17, 0x78, 0x00}, // 0xc5 &Aring;
-  {0x7E, 0x09, 0x09, 0x7F, 0x49, 0x00}, // 0xc6 &AElig;
-  {0x1E, 0xA1, 0xA1, 0xE1, 0x12, 0x00}, // 0xc7 &Ccedil;
-  {0x7C, 0x55, 0x56, 0x54, 0x44, 0x00}, // 0xc8 &Egrave;
-  {0x7C, 0x54, 0x56, 0x55, 0x44, 0x00}, // 0xc9 &Eacute;
-  {0x7C, 0x56, 0x55, 0x56, 0x44, 0x00}, // 0xca &Ecirc;
-  {0x7C, 0x55, 0x54, 0x55, 0x44, 0x00}, // 0xcb &Euml;
-  {0x00, 0x45, 0x7E, 0x44, 0x00, 0x00}, // 0xcc &Igrave;
-  {0x00, 0x44, 0x7E, 0x45, 0x00, 0x00}, // 0xcd &Iacute;
-  {0x00, 0x46, 0x7D, 0x46, 0x00, 0x00}, // 0xce &Icirc;
-  {0x00, 0x45, 0x7C, 0x45, 0x00, 0x00}, // 0xcf &Iuml;
-  {0x49, 0x7F, 0x49, 0x41, 0x3E, 0x00}, // 0xd0 &ETH;
-  {0x7A, 0x09, 0x12, 0x22, 0x79, 0x00}, // 0xd1 &Ntilde;
-  {0x38, 0x45, 0x46, 0x44, 0x38, 0x00}, // 0xd2 &Ograve;
-  {0x38, 0x44, 0x46, 0x45, 0x38, 0x00}, // 0xd3 &Oacute;
-  {0x38, 0x46, 0x45, 0x46, 0x38, 0x00}, // 0xd4 &Ocirc;
-  {0x3A, 0x45, 0x46, 0x46, 0x39, 0x00}, // 0xd5 &Otilde;
-  {0x38, 0x45, 0x44, 0x45, 0x38, 0x00}, // 0xd6 &Ouml;
-  {0x22, 0x14, 0x08, 0x14, 0x22, 0x00}, // 0xd7 &times;
-  {0x3E, 0x71, 0x49, 0x47, 0x3E, 0x00}, // 0xd8 &Oslash;
-  {0x3C, 0x41, 0x42, 0x40, 0x3C, 0x00}, // 0xd9 &Ugrave;
-  {0x3C, 0x40, 0x42, 0x41, 0x3C, 0x00}, // 0xda &Uacute;
-  {0x3C, 0x42, 0x41, 0x42, 0x3C, 0x00}, // 0xdb &Ucirc;
-  {0x3C, 0x41, 0x40, 0x41, 0x3C, 0x00}, // 0xdc &Uuml;
-  {0x04, 0x48, 0x72, 0x49, 0x04, 0x00}, // 0xdd &Yacute;
-  {0x41, 0x7F, 0x55, 0x55, 0x08, 0x00}, // 0xde &THORN;
-  {0x00, 0x7E, 0x01, 0x49, 0x36, 0x00}, // 0xdf &szlig;
-  {0x20, 0x55, 0x56, 0x54, 0x78, 0x00}, // 0xe0 &agrave;
-  {0x20, 0x54, 0x56, 0x55, 0x78, 0x00}, // 0xe1 &aacute;
-  {0x20, 0x56, 0x55, 0x56, 0x78, 0x00}, // 0xe2 &acirc;
-  {0x22, 0x55, 0x56, 0x56, 0x79, 0x00}, // 0xe3 &atilde;
-  {0x20, 0x55, 0x54, 0x55, 0x78, 0x00}, // 0xe4 &auml;
-  {0x20, 0x54, 0x57, 0x57, 0x78, 0x00}, // 0xe5 &aring;
-  {0x24, 0x54, 0x78, 0x54, 0x58, 0x00}, // 0xe6 &aelig;
-  {0x18, 0xA4, 0xE4, 0x24, 0x24, 0x00}, // 0xe7 &ccedil;
-  {0x38, 0x55, 0x56, 0x54, 0x18, 0x00}, // 0xe8 &egrave;
-  {0x38, 0x54, 0x56, 0x55, 0x18, 0x00}, // 0xe9 &eacute;
-  {0x38, 0x56, 0x55, 0x56, 0x18, 0x00}, // 0xea &ecirc;
-  {0x38, 0x55, 0x54, 0x55, 0x18, 0x00}, // 0xeb &euml;
-  {0x00, 0x49, 0x7A, 0x40, 0x00, 0x00}, // 0xec &igrave;
-  {0x00, 0x48, 0x7A, 0x41, 0x00, 0x00}, // 0xed &iacute;
-  {0x00, 0x4A, 0x79, 0x42, 0x00, 0x00}, // 0xee &icirc;
-  {0x00, 0x49, 0x78, 0x41, 0x00, 0x00}, // 0xef &iuml;
-  {0x20, 0x55, 0x52, 0x55, 0x38, 0x00}, // 0xf0 &eth;
-  {0x7A, 0x11, 0x0A, 0x0A, 0x71, 0x00}, // 0xf1 &ntilde;
-  {0x30, 0x49, 0x4A, 0x48, 0x30, 0x00}, // 0xf2 &ograve;
-  {0x30, 0x48, 0x4A, 0x49, 0x30, 0x00}, // 0xf3 &oacute;
-  {0x30, 0x4A, 0x49, 0x4A, 0x30, 0x00}, // 0xf4 &ocirc;
-  {0x32, 0x49, 0x4A, 0x4A, 0x31, 0x00}, // 0xf5 &otilde;
-  {0x30, 0x49, 0x48, 0x49, 0x30, 0x00}, // 0xf6 &ouml;
-  {0x08, 0x6B, 0x6B, 0x08, 0x00, 0x00}, // 0xf7 &divide;
-  {0x58, 0x64, 0x54, 0x4C, 0x34, 0x00}, // 0xf8 &oslash;
-  {0x38, 0x41, 0x42, 0x20, 0x78, 0x00}, // 0xf9 &ugrave;
-  {0x38, 0x40, 0x42, 0x21, 0x78, 0x00}, // 0xfa &uacute;
-  {0x38, 0x42, 0x41, 0x22, 0x78, 0x00}, // 0xfb &ucirc;
-  {0x38, 0x41, 0x40, 0x21, 0x78, 0x00}, // 0xfc &uuml;
-  {0x18, 0xA0, 0xA2, 0xA1, 0x78, 0x00}, // 0xfd &yacute;
-  {0x00, 0x82, 0xFE, 0xA8, 0x10, 0x00}, // 0xfe &thorn;
-  {0x18, 0xA1, 0xA0, 0xA1, 0x78, 0x00}  // 0xff &yuml;
-};
-
-#endif /* FONT_6X8_ISO8859_1 */